@@ -1,40 +0,0 @@
-var Tc=Object.defineProperty;var zc=(e,t,n)=>t in e?Tc(e,t,{enumerable:!0,configurable:!0,writable:!0,value:n}):e[t]=n;var pe=(e,t,n)=>zc(e,typeof t!="symbol"?t+"":t,n);(function(){const t=document.createElement("link").relList;if(t&&t.supports&&t.supports("modulepreload"))return;for(const l of document.querySelectorAll('link[rel="modulepreload"]'))r(l);new MutationObserver(l=>{for(const i of l)if(i.type==="childList")for(const o of i.addedNodes)o.tagName==="LINK"&&o.rel==="modulepreload"&&r(o)}).observe(document,{childList:!0,subtree:!0});function n(l){const i={};return l.integrity&&(i.integrity=l.integrity),l.referrerPolicy&&(i.referrerPolicy=l.referrerPolicy),l.crossOrigin==="use-credentials"?i.credentials="include":l.crossOrigin==="anonymous"?i.credentials="omit":i.credentials="same-origin",i}function r(l){if(l.ep)return;l.ep=!0;const i=n(l);fetch(l.href,i)}})();function Mc(e){return e&&e.__esModule&&Object.prototype.hasOwnProperty.call(e,"default")?e.default:e}var vs={exports:{}},yl={},hs={exports:{}},I={};/**
- * @license React
- * react.production.min.js
- *
- * Copyright (c) Facebook, Inc. and its affiliates.
- *
- * This source code is licensed under the MIT license found in the
- * LICENSE file in the root directory of this source tree.
- */var cr=Symbol.for("react.element"),jc=Symbol.for("react.portal"),Rc=Symbol.for("react.fragment"),Dc=Symbol.for("react.strict_mode"),Ic=Symbol.for("react.profiler"),Oc=Symbol.for("react.provider"),Fc=Symbol.for("react.context"),Uc=Symbol.for("react.forward_ref"),Vc=Symbol.for("react.suspense"),Ac=Symbol.for("react.memo"),$c=Symbol.for("react.lazy"),ru=Symbol.iterator;function Wc(e){return e===null||typeof e!="object"?null:(e=ru&&e[ru]||e["@@iterator"],typeof e=="function"?e:null)}var ms={isMounted:function(){return!1},enqueueForceUpdate:function(){},enqueueReplaceState:function(){},enqueueSetState:function(){}},gs=Object.assign,ys={};function Sn(e,t,n){this.props=e,this.context=t,this.refs=ys,this.updater=n||ms}Sn.prototype.isReactComponent={};Sn.prototype.setState=function(e,t){if(typeof e!="object"&&typeof e!="function"&&e!=null)throw Error("setState(...): takes an object of state variables to update or a function which returns an object of state variables.");this.updater.enqueueSetState(this,e,t,"setState")};Sn.prototype.forceUpdate=function(e){this.updater.enqueueForceUpdate(this,e,"forceUpdate")};function ws(){}ws.prototype=Sn.prototype;function oo(e,t,n){this.props=e,this.context=t,this.refs=ys,this.updater=n||ms}var uo=oo.prototype=new ws;uo.constructor=oo;gs(uo,Sn.prototype);uo.isPureReactComponent=!0;var lu=Array.isArray,Ss=Object.prototype.hasOwnProperty,so={current:null},ks={key:!0,ref:!0,__self:!0,__source:!0};function Es(e,t,n){var r,l={},i=null,o=null;if(t!=null)for(r in t.ref!==void 0&&(o=t.ref),t.key!==void 0&&(i=""+t.key),t)Ss.call(t,r)&&!ks.hasOwnProperty(r)&&(l[r]=t[r]);var u=arguments.length-2;if(u===1)l.children=n;else if(1<u){for(var s=Array(u),f=0;f<u;f++)s[f]=arguments[f+2];l.children=s}if(e&&e.defaultProps)for(r in u=e.defaultProps,u)l[r]===void 0&&(l[r]=u[r]);return{$$typeof:cr,type:e,key:i,ref:o,props:l,_owner:so.current}}function Bc(e,t){return{$$typeof:cr,type:e.type,key:t,ref:e.ref,props:e.props,_owner:e._owner}}function ao(e){return typeof e=="object"&&e!==null&&e.$$typeof===cr}function Hc(e){var t={"=":"=0",":":"=2"};return"$"+e.replace(/[=:]/g,function(n){return t[n]})}var iu=/\/+/g;function Ul(e,t){return typeof e=="object"&&e!==null&&e.key!=null?Hc(""+e.key):t.toString(36)}function Ir(e,t,n,r,l){var i=typeof e;(i==="undefined"||i==="boolean")&&(e=null);var o=!1;if(e===null)o=!0;else switch(i){case"string":case"number":o=!0;break;case"object":switch(e.$$typeof){case cr:case jc:o=!0}}if(o)return o=e,l=l(o),e=r===""?"."+Ul(o,0):r,lu(l)?(n="",e!=null&&(n=e.replace(iu,"$&/")+"/"),Ir(l,t,n,"",function(f){return f})):l!=null&&(ao(l)&&(l=Bc(l,n+(!l.key||o&&o.key===l.key?"":(""+l.key).replace(iu,"$&/")+"/")+e)),t.push(l)),1;if(o=0,r=r===""?".":r+":",lu(e))for(var u=0;u<e.length;u++){i=e[u];var s=r+Ul(i,u);o+=Ir(i,t,n,s,l)}else if(s=Wc(e),typeof s=="function")for(e=s.call(e),u=0;!(i=e.next()).done;)i=i.value,s=r+Ul(i,u++),o+=Ir(i,t,n,s,l);else if(i==="object")throw t=String(e),Error("Objects are not valid as a React child (found: "+(t==="[object Object]"?"object with keys {"+Object.keys(e).join(", ")+"}":t)+"). If you meant to render a collection of children, use an array instead.");return o}function yr(e,t,n){if(e==null)return e;var r=[],l=0;return Ir(e,r,"","",function(i){return t.call(n,i,l++)}),r}function Qc(e){if(e._status===-1){var t=e._result;t=t(),t.then(function(n){(e._status===0||e._status===-1)&&(e._status=1,e._result=n)},function(n){(e._status===0||e._status===-1)&&(e._status=2,e._result=n)}),e._status===-1&&(e._status=0,e._result=t)}if(e._status===1)return e._result.default;throw e._result}var fe={current:null},Or={transition:null},Yc={ReactCurrentDispatcher:fe,ReactCurrentBatchConfig:Or,ReactCurrentOwner:so};function xs(){throw Error("act(...) is not supported in production builds of React.")}I.Children={map:yr,forEach:function(e,t,n){yr(e,function(){t.apply(this,arguments)},n)},count:function(e){var t=0;return yr(e,function(){t++}),t},toArray:function(e){return yr(e,function(t){return t})||[]},only:function(e){if(!ao(e))throw Error("React.Children.only expected to receive a single React element child.");return e}};I.Component=Sn;I.Fragment=Rc;I.Profiler=Ic;I.PureComponent=oo;I.StrictMode=Dc;I.Suspense=Vc;I.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED=Yc;I.act=xs;I.cloneElement=function(e,t,n){if(e==null)throw Error("React.cloneElement(...): The argument must be a React element, but you passed "+e+".");var r=gs({},e.props),l=e.key,i=e.ref,o=e._owner;if(t!=null){if(t.ref!==void 0&&(i=t.ref,o=so.current),t.key!==void 0&&(l=""+t.key),e.type&&e.type.defaultProps)var u=e.type.defaultProps;for(s in t)Ss.call(t,s)&&!ks.hasOwnProperty(s)&&(r[s]=t[s]===void 0&&u!==void 0?u[s]:t[s])}var s=arguments.length-2;if(s===1)r.children=n;else if(1<s){u=Array(s);for(var f=0;f<s;f++)u[f]=arguments[f+2];r.children=u}return{$$typeof:cr,type:e.type,key:l,ref:i,props:r,_owner:o}};I.createContext=function(e){return e={$$typeof:Fc,_currentValue:e,_currentValue2:e,_threadCount:0,Provider:null,Consumer:null,_defaultValue:null,_globalName:null},e.Provider={$$typeof:Oc,_context:e},e.Consumer=e};I.createElement=Es;I.createFactory=function(e){var t=Es.bind(null,e);return t.type=e,t};I.createRef=function(){return{current:null}};I.forwardRef=function(e){return{$$typeof:Uc,render:e}};I.isValidElement=ao;I.lazy=function(e){return{$$typeof:$c,_payload:{_status:-1,_result:e},_init:Qc}};I.memo=function(e,t){return{$$typeof:Ac,type:e,compare:t===void 0?null:t}};I.startTransition=function(e){var t=Or.transition;Or.transition={};try{e()}finally{Or.transition=t}};I.unstable_act=xs;I.useCallback=function(e,t){return fe.current.useCallback(e,t)};I.useContext=function(e){return fe.current.useContext(e)};I.useDebugValue=function(){};I.useDeferredValue=function(e){return fe.current.useDeferredValue(e)};I.useEffect=function(e,t){return fe.current.useEffect(e,t)};I.useId=function(){return fe.current.useId()};I.useImperativeHandle=function(e,t,n){return fe.current.useImperativeHandle(e,t,n)};I.useInsertionEffect=function(e,t){return fe.current.useInsertionEffect(e,t)};I.useLayoutEffect=function(e,t){return fe.current.useLayoutEffect(e,t)};I.useMemo=function(e,t){return fe.current.useMemo(e,t)};I.useReducer=function(e,t,n){return fe.current.useReducer(e,t,n)};I.useRef=function(e){return fe.current.useRef(e)};I.useState=function(e){return fe.current.useState(e)};I.useSyncExternalStore=function(e,t,n){return fe.current.useSyncExternalStore(e,t,n)};I.useTransition=function(){return fe.current.useTransition()};I.version="18.3.1";hs.exports=I;var z=hs.exports;const Kc=Mc(z);/**
- * @license React
- * react-jsx-runtime.production.min.js
- *
- * Copyright (c) Facebook, Inc. and its affiliates.
- *
- * This source code is licensed under the MIT license found in the
- * LICENSE file in the root directory of this source tree.
- */var Xc=z,Gc=Symbol.for("react.element"),Jc=Symbol.for("react.fragment"),Zc=Object.prototype.hasOwnProperty,qc=Xc.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED.ReactCurrentOwner,bc={key:!0,ref:!0,__self:!0,__source:!0};function Cs(e,t,n){var r,l={},i=null,o=null;n!==void 0&&(i=""+n),t.key!==void 0&&(i=""+t.key),t.ref!==void 0&&(o=t.ref);for(r in t)Zc.call(t,r)&&!bc.hasOwnProperty(r)&&(l[r]=t[r]);if(e&&e.defaultProps)for(r in t=e.defaultProps,t)l[r]===void 0&&(l[r]=t[r]);return{$$typeof:Gc,type:e,key:i,ref:o,props:l,_owner:qc.current}}yl.Fragment=Jc;yl.jsx=Cs;yl.jsxs=Cs;vs.exports=yl;var w=vs.exports,di={},_s={exports:{}},Ce={},Ns={exports:{}},Ls={};/**
- * @license React
- * scheduler.production.min.js
- *
- * Copyright (c) Facebook, Inc. and its affiliates.
- *
- * This source code is licensed under the MIT license found in the
- * LICENSE file in the root directory of this source tree.
- */(function(e){function t(_,j){var R=_.length;_.push(j);e:for(;0<R;){var U=R-1>>>1,B=_[U];if(0<l(B,j))_[U]=j,_[R]=B,R=U;else break e}}function n(_){return _.length===0?null:_[0]}function r(_){if(_.length===0)return null;var j=_[0],R=_.pop();if(R!==j){_[0]=R;e:for(var U=0,B=_.length,Yt=B>>>1;U<Yt;){var Re=2*(U+1)-1,mr=_[Re],Ge=Re+1,ot=_[Ge];if(0>l(mr,R))Ge<B&&0>l(ot,mr)?(_[U]=ot,_[Ge]=R,U=Ge):(_[U]=mr,_[Re]=R,U=Re);else if(Ge<B&&0>l(ot,R))_[U]=ot,_[Ge]=R,U=Ge;else break e}}return j}function l(_,j){var R=_.sortIndex-j.sortIndex;return R!==0?R:_.id-j.id}if(typeof performance=="object"&&typeof performance.now=="function"){var i=performance;e.unstable_now=function(){return i.now()}}else{var o=Date,u=o.now();e.unstable_now=function(){return o.now()-u}}var s=[],f=[],m=1,h=null,v=3,S=!1,y=!1,k=!1,D=typeof setTimeout=="function"?setTimeout:null,d=typeof clearTimeout=="function"?clearTimeout:null,a=typeof setImmediate<"u"?setImmediate:null;typeof navigator<"u"&&navigator.scheduling!==void 0&&navigator.scheduling.isInputPending!==void 0&&navigator.scheduling.isInputPending.bind(navigator.scheduling);function c(_){for(var j=n(f);j!==null;){if(j.callback===null)r(f);else if(j.startTime<=_)r(f),j.sortIndex=j.expirationTime,t(s,j);else break;j=n(f)}}function p(_){if(k=!1,c(_),!y)if(n(s)!==null)y=!0,xn(C);else{var j=n(f);j!==null&&je(p,j.startTime-_)}}function C(_,j){y=!1,k&&(k=!1,d(E),E=-1),S=!0;var R=v;try{for(c(j),h=n(s);h!==null&&(!(h.expirationTime>j)||_&&!we());){var U=h.callback;if(typeof U=="function"){h.callback=null,v=h.priorityLevel;var B=U(h.expirationTime<=j);j=e.unstable_now(),typeof B=="function"?h.callback=B:h===n(s)&&r(s),c(j)}else r(s);h=n(s)}if(h!==null)var Yt=!0;else{var Re=n(f);Re!==null&&je(p,Re.startTime-j),Yt=!1}return Yt}finally{h=null,v=R,S=!1}}var P=!1,N=null,E=-1,T=5,M=-1;function we(){return!(e.unstable_now()-M<T)}function Pt(){if(N!==null){var _=e.unstable_now();M=_;var j=!0;try{j=N(!0,_)}finally{j?Tt():(P=!1,N=null)}}else P=!1}var Tt;if(typeof a=="function")Tt=function(){a(Pt)};else if(typeof MessageChannel<"u"){var hr=new MessageChannel,Qt=hr.port2;hr.port1.onmessage=Pt,Tt=function(){Qt.postMessage(null)}}else Tt=function(){D(Pt,0)};function xn(_){N=_,P||(P=!0,Tt())}function je(_,j){E=D(function(){_(e.unstable_now())},j)}e.unstable_IdlePriority=5,e.unstable_ImmediatePriority=1,e.unstable_LowPriority=4,e.unstable_NormalPriority=3,e.unstable_Profiling=null,e.unstable_UserBlockingPriority=2,e.unstable_cancelCallback=function(_){_.callback=null},e.unstable_continueExecution=function(){y||S||(y=!0,xn(C))},e.unstable_forceFrameRate=function(_){0>_||125<_?console.error("forceFrameRate takes a positive int between 0 and 125, forcing frame rates higher than 125 fps is not supported"):T=0<_?Math.floor(1e3/_):5},e.unstable_getCurrentPriorityLevel=function(){return v},e.unstable_getFirstCallbackNode=function(){return n(s)},e.unstable_next=function(_){switch(v){case 1:case 2:case 3:var j=3;break;default:j=v}var R=v;v=j;try{return _()}finally{v=R}},e.unstable_pauseExecution=function(){},e.unstable_requestPaint=function(){},e.unstable_runWithPriority=function(_,j){switch(_){case 1:case 2:case 3:case 4:case 5:break;default:_=3}var R=v;v=_;try{return j()}finally{v=R}},e.unstable_scheduleCallback=function(_,j,R){var U=e.unstable_now();switch(typeof R=="object"&&R!==null?(R=R.delay,R=typeof R=="number"&&0<R?U+R:U):R=U,_){case 1:var B=-1;break;case 2:B=250;break;case 5:B=1073741823;break;case 4:B=1e4;break;default:B=5e3}return B=R+B,_={id:m++,callback:j,priorityLevel:_,startTime:R,expirationTime:B,sortIndex:-1},R>U?(_.sortIndex=R,t(f,_),n(s)===null&&_===n(f)&&(k?(d(E),E=-1):k=!0,je(p,R-U))):(_.sortIndex=B,t(s,_),y||S||(y=!0,xn(C))),_},e.unstable_shouldYield=we,e.unstable_wrapCallback=function(_){var j=v;return function(){var R=v;v=j;try{return _.apply(this,arguments)}finally{v=R}}}})(Ls);Ns.exports=Ls;var ef=Ns.exports;/**
- * @license React
- * react-dom.production.min.js
- *
- * Copyright (c) Facebook, Inc. and its affiliates.
- *
- * This source code is licensed under the MIT license found in the
- * LICENSE file in the root directory of this source tree.
- */var tf=z,xe=ef;function g(e){for(var t="https://reactjs.org/docs/error-decoder.html?invariant="+e,n=1;n<arguments.length;n++)t+="&args[]="+encodeURIComponent(arguments[n]);return"Minified React error #"+e+"; visit "+t+" for the full message or use the non-minified dev environment for full errors and additional helpful warnings."}var Ps=new Set,Kn={};function Bt(e,t){pn(e,t),pn(e+"Capture",t)}function pn(e,t){for(Kn[e]=t,e=0;e<t.length;e++)Ps.add(t[e])}var tt=!(typeof window>"u"||typeof window.document>"u"||typeof window.document.createElement>"u"),pi=Object.prototype.hasOwnProperty,nf=/^[:A-Z_a-z\u00C0-\u00D6\u00D8-\u00F6\u00F8-\u02FF\u0370-\u037D\u037F-\u1FFF\u200C-\u200D\u2070-\u218F\u2C00-\u2FEF\u3001-\uD7FF\uF900-\uFDCF\uFDF0-\uFFFD][:A-Z_a-z\u00C0-\u00D6\u00D8-\u00F6\u00F8-\u02FF\u0370-\u037D\u037F-\u1FFF\u200C-\u200D\u2070-\u218F\u2C00-\u2FEF\u3001-\uD7FF\uF900-\uFDCF\uFDF0-\uFFFD\-.0-9\u00B7\u0300-\u036F\u203F-\u2040]*$/,ou={},uu={};function rf(e){return pi.call(uu,e)?!0:pi.call(ou,e)?!1:nf.test(e)?uu[e]=!0:(ou[e]=!0,!1)}function lf(e,t,n,r){if(n!==null&&n.type===0)return!1;switch(typeof t){case"function":case"symbol":return!0;case"boolean":return r?!1:n!==null?!n.acceptsBooleans:(e=e.toLowerCase().slice(0,5),e!=="data-"&&e!=="aria-");default:return!1}}function of(e,t,n,r){if(t===null||typeof t>"u"||lf(e,t,n,r))return!0;if(r)return!1;if(n!==null)switch(n.type){case 3:return!t;case 4:return t===!1;case 5:return isNaN(t);case 6:return isNaN(t)||1>t}return!1}function de(e,t,n,r,l,i,o){this.acceptsBooleans=t===2||t===3||t===4,this.attributeName=r,this.attributeNamespace=l,this.mustUseProperty=n,this.propertyName=e,this.type=t,this.sanitizeURL=i,this.removeEmptyString=o}var re={};"children dangerouslySetInnerHTML defaultValue defaultChecked innerHTML suppressContentEditableWarning suppressHydrationWarning style".split(" ").forEach(function(e){re[e]=new de(e,0,!1,e,null,!1,!1)});[["acceptCharset","accept-charset"],["className","class"],["htmlFor","for"],["httpEquiv","http-equiv"]].forEach(function(e){var t=e[0];re[t]=new de(t,1,!1,e[1],null,!1,!1)});["contentEditable","draggable","spellCheck","value"].forEach(function(e){re[e]=new de(e,2,!1,e.toLowerCase(),null,!1,!1)});["autoReverse","externalResourcesRequired","focusable","preserveAlpha"].forEach(function(e){re[e]=new de(e,2,!1,e,null,!1,!1)});"allowFullScreen async autoFocus autoPlay controls default defer disabled disablePictureInPicture disableRemotePlayback formNoValidate hidden loop noModule noValidate open playsInline readOnly required reversed scoped seamless itemScope".split(" ").forEach(function(e){re[e]=new de(e,3,!1,e.toLowerCase(),null,!1,!1)});["checked","multiple","muted","selected"].forEach(function(e){re[e]=new de(e,3,!0,e,null,!1,!1)});["capture","download"].forEach(function(e){re[e]=new de(e,4,!1,e,null,!1,!1)});["cols","rows","size","span"].forEach(function(e){re[e]=new de(e,6,!1,e,null,!1,!1)});["rowSpan","start"].forEach(function(e){re[e]=new de(e,5,!1,e.toLowerCase(),null,!1,!1)});var co=/[\-:]([a-z])/g;function fo(e){return e[1].toUpperCase()}"accent-height alignment-baseline arabic-form baseline-shift cap-height clip-path clip-rule color-interpolation color-interpolation-filters color-profile color-rendering dominant-baseline enable-background fill-opacity fill-rule flood-color flood-opacity font-family font-size font-size-adjust font-stretch font-style font-variant font-weight glyph-name glyph-orientation-horizontal glyph-orientation-vertical horiz-adv-x horiz-origin-x image-rendering letter-spacing lighting-color marker-end marker-mid marker-start overline-position overline-thickness paint-order panose-1 pointer-events rendering-intent shape-rendering stop-color stop-opacity strikethrough-position strikethrough-thickness stroke-dasharray stroke-dashoffset stroke-linecap stroke-linejoin stroke-miterlimit stroke-opacity stroke-width text-anchor text-decoration text-rendering underline-position underline-thickness unicode-bidi unicode-range units-per-em v-alphabetic v-hanging v-ideographic v-mathematical vector-effect vert-adv-y vert-origin-x vert-origin-y word-spacing writing-mode xmlns:xlink x-height".split(" ").forEach(function(e){var t=e.replace(co,fo);re[t]=new de(t,1,!1,e,null,!1,!1)});"xlink:actuate xlink:arcrole xlink:role xlink:show xlink:title xlink:type".split(" ").forEach(function(e){var t=e.replace(co,fo);re[t]=new de(t,1,!1,e,"http://www.w3.org/1999/xlink",!1,!1)});["xml:base","xml:lang","xml:space"].forEach(function(e){var t=e.replace(co,fo);re[t]=new de(t,1,!1,e,"http://www.w3.org/XML/1998/namespace",!1,!1)});["tabIndex","crossOrigin"].forEach(function(e){re[e]=new de(e,1,!1,e.toLowerCase(),null,!1,!1)});re.xlinkHref=new de("xlinkHref",1,!1,"xlink:href","http://www.w3.org/1999/xlink",!0,!1);["src","href","action","formAction"].forEach(function(e){re[e]=new de(e,1,!1,e.toLowerCase(),null,!0,!0)});function po(e,t,n,r){var l=re.hasOwnProperty(t)?re[t]:null;(l!==null?l.type!==0:r||!(2<t.length)||t[0]!=="o"&&t[0]!=="O"||t[1]!=="n"&&t[1]!=="N")&&(of(t,n,l,r)&&(n=null),r||l===null?rf(t)&&(n===null?e.removeAttribute(t):e.setAttribute(t,""+n)):l.mustUseProperty?e[l.propertyName]=n===null?l.type===3?!1:"":n:(t=l.attributeName,r=l.attributeNamespace,n===null?e.removeAttribute(t):(l=l.type,n=l===3||l===4&&n===!0?"":""+n,r?e.setAttributeNS(r,t,n):e.setAttribute(t,n))))}var it=tf.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED,wr=Symbol.for("react.element"),Xt=Symbol.for("react.portal"),Gt=Symbol.for("react.fragment"),vo=Symbol.for("react.strict_mode"),vi=Symbol.for("react.profiler"),Ts=Symbol.for("react.provider"),zs=Symbol.for("react.context"),ho=Symbol.for("react.forward_ref"),hi=Symbol.for("react.suspense"),mi=Symbol.for("react.suspense_list"),mo=Symbol.for("react.memo"),at=Symbol.for("react.lazy"),Ms=Symbol.for("react.offscreen"),su=Symbol.iterator;function _n(e){return e===null||typeof e!="object"?null:(e=su&&e[su]||e["@@iterator"],typeof e=="function"?e:null)}var Y=Object.assign,Vl;function Rn(e){if(Vl===void 0)try{throw Error()}catch(n){var t=n.stack.trim().match(/\n( *(at )?)/);Vl=t&&t[1]||""}return`
-`+Vl+e}var Al=!1;function $l(e,t){if(!e||Al)return"";Al=!0;var n=Error.prepareStackTrace;Error.prepareStackTrace=void 0;try{if(t)if(t=function(){throw Error()},Object.defineProperty(t.prototype,"props",{set:function(){throw Error()}}),typeof Reflect=="object"&&Reflect.construct){try{Reflect.construct(t,[])}catch(f){var r=f}Reflect.construct(e,[],t)}else{try{t.call()}catch(f){r=f}e.call(t.prototype)}else{try{throw Error()}catch(f){r=f}e()}}catch(f){if(f&&r&&typeof f.stack=="string"){for(var l=f.stack.split(`
-`),i=r.stack.split(`
-`),o=l.length-1,u=i.length-1;1<=o&&0<=u&&l[o]!==i[u];)u--;for(;1<=o&&0<=u;o--,u--)if(l[o]!==i[u]){if(o!==1||u!==1)do if(o--,u--,0>u||l[o]!==i[u]){var s=`
-`+l[o].replace(" at new "," at ");return e.displayName&&s.includes("<anonymous>")&&(s=s.replace("<anonymous>",e.displayName)),s}while(1<=o&&0<=u);break}}}finally{Al=!1,Error.prepareStackTrace=n}return(e=e?e.displayName||e.name:"")?Rn(e):""}function uf(e){switch(e.tag){case 5:return Rn(e.type);case 16:return Rn("Lazy");case 13:return Rn("Suspense");case 19:return Rn("SuspenseList");case 0:case 2:case 15:return e=$l(e.type,!1),e;case 11:return e=$l(e.type.render,!1),e;case 1:return e=$l(e.type,!0),e;default:return""}}function gi(e){if(e==null)return null;if(typeof e=="function")return e.displayName||e.name||null;if(typeof e=="string")return e;switch(e){case Gt:return"Fragment";case Xt:return"Portal";case vi:return"Profiler";case vo:return"StrictMode";case hi:return"Suspense";case mi:return"SuspenseList"}if(typeof e=="object")switch(e.$$typeof){case zs:return(e.displayName||"Context")+".Consumer";case Ts:return(e._context.displayName||"Context")+".Provider";case ho:var t=e.render;return e=e.displayName,e||(e=t.displayName||t.name||"",e=e!==""?"ForwardRef("+e+")":"ForwardRef"),e;case mo:return t=e.displayName||null,t!==null?t:gi(e.type)||"Memo";case at:t=e._payload,e=e._init;try{return gi(e(t))}catch{}}return null}function sf(e){var t=e.type;switch(e.tag){case 24:return"Cache";case 9:return(t.displayName||"Context")+".Consumer";case 10:return(t._context.displayName||"Context")+".Provider";case 18:return"DehydratedFragment";case 11:return e=t.render,e=e.displayName||e.name||"",t.displayName||(e!==""?"ForwardRef("+e+")":"ForwardRef");case 7:return"Fragment";case 5:return t;case 4:return"Portal";case 3:return"Root";case 6:return"Text";case 16:return gi(t);case 8:return t===vo?"StrictMode":"Mode";case 22:return"Offscreen";case 12:return"Profiler";case 21:return"Scope";case 13:return"Suspense";case 19:return"SuspenseList";case 25:return"TracingMarker";case 1:case 0:case 17:case 2:case 14:case 15:if(typeof t=="function")return t.displayName||t.name||null;if(typeof t=="string")return t}return null}function xt(e){switch(typeof e){case"boolean":case"number":case"string":case"undefined":return e;case"object":return e;default:return""}}function js(e){var t=e.type;return(e=e.nodeName)&&e.toLowerCase()==="input"&&(t==="checkbox"||t==="radio")}function af(e){var t=js(e)?"checked":"value",n=Object.getOwnPropertyDescriptor(e.constructor.prototype,t),r=""+e[t];if(!e.hasOwnProperty(t)&&typeof n<"u"&&typeof n.get=="function"&&typeof n.set=="function"){var l=n.get,i=n.set;return Object.defineProperty(e,t,{configurable:!0,get:function(){return l.call(this)},set:function(o){r=""+o,i.call(this,o)}}),Object.defineProperty(e,t,{enumerable:n.enumerable}),{getValue:function(){return r},setValue:function(o){r=""+o},stopTracking:function(){e._valueTracker=null,delete e[t]}}}}function Sr(e){e._valueTracker||(e._valueTracker=af(e))}function Rs(e){if(!e)return!1;var t=e._valueTracker;if(!t)return!0;var n=t.getValue(),r="";return e&&(r=js(e)?e.checked?"true":"false":e.value),e=r,e!==n?(t.setValue(e),!0):!1}function Kr(e){if(e=e||(typeof document<"u"?document:void 0),typeof e>"u")return null;try{return e.activeElement||e.body}catch{return e.body}}function yi(e,t){var n=t.checked;return Y({},t,{defaultChecked:void 0,defaultValue:void 0,value:void 0,checked:n??e._wrapperState.initialChecked})}function au(e,t){var n=t.defaultValue==null?"":t.defaultValue,r=t.checked!=null?t.checked:t.defaultChecked;n=xt(t.value!=null?t.value:n),e._wrapperState={initialChecked:r,initialValue:n,controlled:t.type==="checkbox"||t.type==="radio"?t.checked!=null:t.value!=null}}function Ds(e,t){t=t.checked,t!=null&&po(e,"checked",t,!1)}function wi(e,t){Ds(e,t);var n=xt(t.value),r=t.type;if(n!=null)r==="number"?(n===0&&e.value===""||e.value!=n)&&(e.value=""+n):e.value!==""+n&&(e.value=""+n);else if(r==="submit"||r==="reset"){e.removeAttribute("value");return}t.hasOwnProperty("value")?Si(e,t.type,n):t.hasOwnProperty("defaultValue")&&Si(e,t.type,xt(t.defaultValue)),t.checked==null&&t.defaultChecked!=null&&(e.defaultChecked=!!t.defaultChecked)}function cu(e,t,n){if(t.hasOwnProperty("value")||t.hasOwnProperty("defaultValue")){var r=t.type;if(!(r!=="submit"&&r!=="reset"||t.value!==void 0&&t.value!==null))return;t=""+e._wrapperState.initialValue,n||t===e.value||(e.value=t),e.defaultValue=t}n=e.name,n!==""&&(e.name=""),e.defaultChecked=!!e._wrapperState.initialChecked,n!==""&&(e.name=n)}function Si(e,t,n){(t!=="number"||Kr(e.ownerDocument)!==e)&&(n==null?e.defaultValue=""+e._wrapperState.initialValue:e.defaultValue!==""+n&&(e.defaultValue=""+n))}var Dn=Array.isArray;function un(e,t,n,r){if(e=e.options,t){t={};for(var l=0;l<n.length;l++)t["$"+n[l]]=!0;for(n=0;n<e.length;n++)l=t.hasOwnProperty("$"+e[n].value),e[n].selected!==l&&(e[n].selected=l),l&&r&&(e[n].defaultSelected=!0)}else{for(n=""+xt(n),t=null,l=0;l<e.length;l++){if(e[l].value===n){e[l].selected=!0,r&&(e[l].defaultSelected=!0);return}t!==null||e[l].disabled||(t=e[l])}t!==null&&(t.selected=!0)}}function ki(e,t){if(t.dangerouslySetInnerHTML!=null)throw Error(g(91));return Y({},t,{value:void 0,defaultValue:void 0,children:""+e._wrapperState.initialValue})}function fu(e,t){var n=t.value;if(n==null){if(n=t.children,t=t.defaultValue,n!=null){if(t!=null)throw Error(g(92));if(Dn(n)){if(1<n.length)throw Error(g(93));n=n[0]}t=n}t==null&&(t=""),n=t}e._wrapperState={initialValue:xt(n)}}function Is(e,t){var n=xt(t.value),r=xt(t.defaultValue);n!=null&&(n=""+n,n!==e.value&&(e.value=n),t.defaultValue==null&&e.defaultValue!==n&&(e.defaultValue=n)),r!=null&&(e.defaultValue=""+r)}function du(e){var t=e.textContent;t===e._wrapperState.initialValue&&t!==""&&t!==null&&(e.value=t)}function Os(e){switch(e){case"svg":return"http://www.w3.org/2000/svg";case"math":return"http://www.w3.org/1998/Math/MathML";default:return"http://www.w3.org/1999/xhtml"}}function Ei(e,t){return e==null||e==="http://www.w3.org/1999/xhtml"?Os(t):e==="http://www.w3.org/2000/svg"&&t==="foreignObject"?"http://www.w3.org/1999/xhtml":e}var kr,Fs=function(e){return typeof MSApp<"u"&&MSApp.execUnsafeLocalFunction?function(t,n,r,l){MSApp.execUnsafeLocalFunction(function(){return e(t,n,r,l)})}:e}(function(e,t){if(e.namespaceURI!=="http://www.w3.org/2000/svg"||"innerHTML"in e)e.innerHTML=t;else{for(kr=kr||document.createElement("div"),kr.innerHTML="<svg>"+t.valueOf().toString()+"</svg>",t=kr.firstChild;e.firstChild;)e.removeChild(e.firstChild);for(;t.firstChild;)e.appendChild(t.firstChild)}});function Xn(e,t){if(t){var n=e.firstChild;if(n&&n===e.lastChild&&n.nodeType===3){n.nodeValue=t;return}}e.textContent=t}var Fn={animationIterationCount:!0,aspectRatio:!0,borderImageOutset:!0,borderImageSlice:!0,borderImageWidth:!0,boxFlex:!0,boxFlexGroup:!0,boxOrdinalGroup:!0,columnCount:!0,columns:!0,flex:!0,flexGrow:!0,flexPositive:!0,flexShrink:!0,flexNegative:!0,flexOrder:!0,gridArea:!0,gridRow:!0,gridRowEnd:!0,gridRowSpan:!0,gridRowStart:!0,gridColumn:!0,gridColumnEnd:!0,gridColumnSpan:!0,gridColumnStart:!0,fontWeight:!0,lineClamp:!0,lineHeight:!0,opacity:!0,order:!0,orphans:!0,tabSize:!0,widows:!0,zIndex:!0,zoom:!0,fillOpacity:!0,floodOpacity:!0,stopOpacity:!0,strokeDasharray:!0,strokeDashoffset:!0,strokeMiterlimit:!0,strokeOpacity:!0,strokeWidth:!0},cf=["Webkit","ms","Moz","O"];Object.keys(Fn).forEach(function(e){cf.forEach(function(t){t=t+e.charAt(0).toUpperCase()+e.substring(1),Fn[t]=Fn[e]})});function Us(e,t,n){return t==null||typeof t=="boolean"||t===""?"":n||typeof t!="number"||t===0||Fn.hasOwnProperty(e)&&Fn[e]?(""+t).trim():t+"px"}function Vs(e,t){e=e.style;for(var n in t)if(t.hasOwnProperty(n)){var r=n.indexOf("--")===0,l=Us(n,t[n],r);n==="float"&&(n="cssFloat"),r?e.setProperty(n,l):e[n]=l}}var ff=Y({menuitem:!0},{area:!0,base:!0,br:!0,col:!0,embed:!0,hr:!0,img:!0,input:!0,keygen:!0,link:!0,meta:!0,param:!0,source:!0,track:!0,wbr:!0});function xi(e,t){if(t){if(ff[e]&&(t.children!=null||t.dangerouslySetInnerHTML!=null))throw Error(g(137,e));if(t.dangerouslySetInnerHTML!=null){if(t.children!=null)throw Error(g(60));if(typeof t.dangerouslySetInnerHTML!="object"||!("__html"in t.dangerouslySetInnerHTML))throw Error(g(61))}if(t.style!=null&&typeof t.style!="object")throw Error(g(62))}}function Ci(e,t){if(e.indexOf("-")===-1)return typeof t.is=="string";switch(e){case"annotation-xml":case"color-profile":case"font-face":case"font-face-src":case"font-face-uri":case"font-face-format":case"font-face-name":case"missing-glyph":return!1;default:return!0}}var _i=null;function go(e){return e=e.target||e.srcElement||window,e.correspondingUseElement&&(e=e.correspondingUseElement),e.nodeType===3?e.parentNode:e}var Ni=null,sn=null,an=null;function pu(e){if(e=pr(e)){if(typeof Ni!="function")throw Error(g(280));var t=e.stateNode;t&&(t=xl(t),Ni(e.stateNode,e.type,t))}}function As(e){sn?an?an.push(e):an=[e]:sn=e}function $s(){if(sn){var e=sn,t=an;if(an=sn=null,pu(e),t)for(e=0;e<t.length;e++)pu(t[e])}}function Ws(e,t){return e(t)}function Bs(){}var Wl=!1;function Hs(e,t,n){if(Wl)return e(t,n);Wl=!0;try{return Ws(e,t,n)}finally{Wl=!1,(sn!==null||an!==null)&&(Bs(),$s())}}function Gn(e,t){var n=e.stateNode;if(n===null)return null;var r=xl(n);if(r===null)return null;n=r[t];e:switch(t){case"onClick":case"onClickCapture":case"onDoubleClick":case"onDoubleClickCapture":case"onMouseDown":case"onMouseDownCapture":case"onMouseMove":case"onMouseMoveCapture":case"onMouseUp":case"onMouseUpCapture":case"onMouseEnter":(r=!r.disabled)||(e=e.type,r=!(e==="button"||e==="input"||e==="select"||e==="textarea")),e=!r;break e;default:e=!1}if(e)return null;if(n&&typeof n!="function")throw Error(g(231,t,typeof n));return n}var Li=!1;if(tt)try{var Nn={};Object.defineProperty(Nn,"passive",{get:function(){Li=!0}}),window.addEventListener("test",Nn,Nn),window.removeEventListener("test",Nn,Nn)}catch{Li=!1}function df(e,t,n,r,l,i,o,u,s){var f=Array.prototype.slice.call(arguments,3);try{t.apply(n,f)}catch(m){this.onError(m)}}var Un=!1,Xr=null,Gr=!1,Pi=null,pf={onError:function(e){Un=!0,Xr=e}};function vf(e,t,n,r,l,i,o,u,s){Un=!1,Xr=null,df.apply(pf,arguments)}function hf(e,t,n,r,l,i,o,u,s){if(vf.apply(this,arguments),Un){if(Un){var f=Xr;Un=!1,Xr=null}else throw Error(g(198));Gr||(Gr=!0,Pi=f)}}function Ht(e){var t=e,n=e;if(e.alternate)for(;t.return;)t=t.return;else{e=t;do t=e,t.flags&4098&&(n=t.return),e=t.return;while(e)}return t.tag===3?n:null}function Qs(e){if(e.tag===13){var t=e.memoizedState;if(t===null&&(e=e.alternate,e!==null&&(t=e.memoizedState)),t!==null)return t.dehydrated}return null}function vu(e){if(Ht(e)!==e)throw Error(g(188))}function mf(e){var t=e.alternate;if(!t){if(t=Ht(e),t===null)throw Error(g(188));return t!==e?null:e}for(var n=e,r=t;;){var l=n.return;if(l===null)break;var i=l.alternate;if(i===null){if(r=l.return,r!==null){n=r;continue}break}if(l.child===i.child){for(i=l.child;i;){if(i===n)return vu(l),e;if(i===r)return vu(l),t;i=i.sibling}throw Error(g(188))}if(n.return!==r.return)n=l,r=i;else{for(var o=!1,u=l.child;u;){if(u===n){o=!0,n=l,r=i;break}if(u===r){o=!0,r=l,n=i;break}u=u.sibling}if(!o){for(u=i.child;u;){if(u===n){o=!0,n=i,r=l;break}if(u===r){o=!0,r=i,n=l;break}u=u.sibling}if(!o)throw Error(g(189))}}if(n.alternate!==r)throw Error(g(190))}if(n.tag!==3)throw Error(g(188));return n.stateNode.current===n?e:t}function Ys(e){return e=mf(e),e!==null?Ks(e):null}function Ks(e){if(e.tag===5||e.tag===6)return e;for(e=e.child;e!==null;){var t=Ks(e);if(t!==null)return t;e=e.sibling}return null}var Xs=xe.unstable_scheduleCallback,hu=xe.unstable_cancelCallback,gf=xe.unstable_shouldYield,yf=xe.unstable_requestPaint,G=xe.unstable_now,wf=xe.unstable_getCurrentPriorityLevel,yo=xe.unstable_ImmediatePriority,Gs=xe.unstable_UserBlockingPriority,Jr=xe.unstable_NormalPriority,Sf=xe.unstable_LowPriority,Js=xe.unstable_IdlePriority,wl=null,Ke=null;function kf(e){if(Ke&&typeof Ke.onCommitFiberRoot=="function")try{Ke.onCommitFiberRoot(wl,e,void 0,(e.current.flags&128)===128)}catch{}}var Ae=Math.clz32?Math.clz32:Cf,Ef=Math.log,xf=Math.LN2;function Cf(e){return e>>>=0,e===0?32:31-(Ef(e)/xf|0)|0}var Er=64,xr=4194304;function In(e){switch(e&-e){case 1:return 1;case 2:return 2;case 4:return 4;case 8:return 8;case 16:return 16;case 32:return 32;case 64:case 128:case 256:case 512:case 1024:case 2048:case 4096:case 8192:case 16384:case 32768:case 65536:case 131072:case 262144:case 524288:case 1048576:case 2097152:return e&4194240;case 4194304:case 8388608:case 16777216:case 33554432:case 67108864:return e&130023424;case 134217728:return 134217728;case 268435456:return 268435456;case 536870912:return 536870912;case 1073741824:return 1073741824;default:return e}}function Zr(e,t){var n=e.pendingLanes;if(n===0)return 0;var r=0,l=e.suspendedLanes,i=e.pingedLanes,o=n&268435455;if(o!==0){var u=o&~l;u!==0?r=In(u):(i&=o,i!==0&&(r=In(i)))}else o=n&~l,o!==0?r=In(o):i!==0&&(r=In(i));if(r===0)return 0;if(t!==0&&t!==r&&!(t&l)&&(l=r&-r,i=t&-t,l>=i||l===16&&(i&4194240)!==0))return t;if(r&4&&(r|=n&16),t=e.entangledLanes,t!==0)for(e=e.entanglements,t&=r;0<t;)n=31-Ae(t),l=1<<n,r|=e[n],t&=~l;return r}function _f(e,t){switch(e){case 1:case 2:case 4:return t+250;case 8:case 16:case 32:case 64:case 128:case 256:case 512:case 1024:case 2048:case 4096:case 8192:case 16384:case 32768:case 65536:case 131072:case 262144:case 524288:case 1048576:case 2097152:return t+5e3;case 4194304:case 8388608:case 16777216:case 33554432:case 67108864:return-1;case 134217728:case 268435456:case 536870912:case 1073741824:return-1;default:return-1}}function Nf(e,t){for(var n=e.suspendedLanes,r=e.pingedLanes,l=e.expirationTimes,i=e.pendingLanes;0<i;){var o=31-Ae(i),u=1<<o,s=l[o];s===-1?(!(u&n)||u&r)&&(l[o]=_f(u,t)):s<=t&&(e.expiredLanes|=u),i&=~u}}function Ti(e){return e=e.pendingLanes&-1073741825,e!==0?e:e&1073741824?1073741824:0}function Zs(){var e=Er;return Er<<=1,!(Er&4194240)&&(Er=64),e}function Bl(e){for(var t=[],n=0;31>n;n++)t.push(e);return t}function fr(e,t,n){e.pendingLanes|=t,t!==536870912&&(e.suspendedLanes=0,e.pingedLanes=0),e=e.eventTimes,t=31-Ae(t),e[t]=n}function Lf(e,t){var n=e.pendingLanes&~t;e.pendingLanes=t,e.suspendedLanes=0,e.pingedLanes=0,e.expiredLanes&=t,e.mutableReadLanes&=t,e.entangledLanes&=t,t=e.entanglements;var r=e.eventTimes;for(e=e.expirationTimes;0<n;){var l=31-Ae(n),i=1<<l;t[l]=0,r[l]=-1,e[l]=-1,n&=~i}}function wo(e,t){var n=e.entangledLanes|=t;for(e=e.entanglements;n;){var r=31-Ae(n),l=1<<r;l&t|e[r]&t&&(e[r]|=t),n&=~l}}var F=0;function qs(e){return e&=-e,1<e?4<e?e&268435455?16:536870912:4:1}var bs,So,ea,ta,na,zi=!1,Cr=[],ht=null,mt=null,gt=null,Jn=new Map,Zn=new Map,ft=[],Pf="mousedown mouseup touchcancel touchend touchstart auxclick dblclick pointercancel pointerdown pointerup dragend dragstart drop compositionend compositionstart keydown keypress keyup input textInput copy cut paste click change contextmenu reset submit".split(" ");function mu(e,t){switch(e){case"focusin":case"focusout":ht=null;break;case"dragenter":case"dragleave":mt=null;break;case"mouseover":case"mouseout":gt=null;break;case"pointerover":case"pointerout":Jn.delete(t.pointerId);break;case"gotpointercapture":case"lostpointercapture":Zn.delete(t.pointerId)}}function Ln(e,t,n,r,l,i){return e===null||e.nativeEvent!==i?(e={blockedOn:t,domEventName:n,eventSystemFlags:r,nativeEvent:i,targetContainers:[l]},t!==null&&(t=pr(t),t!==null&&So(t)),e):(e.eventSystemFlags|=r,t=e.targetContainers,l!==null&&t.indexOf(l)===-1&&t.push(l),e)}function Tf(e,t,n,r,l){switch(t){case"focusin":return ht=Ln(ht,e,t,n,r,l),!0;case"dragenter":return mt=Ln(mt,e,t,n,r,l),!0;case"mouseover":return gt=Ln(gt,e,t,n,r,l),!0;case"pointerover":var i=l.pointerId;return Jn.set(i,Ln(Jn.get(i)||null,e,t,n,r,l)),!0;case"gotpointercapture":return i=l.pointerId,Zn.set(i,Ln(Zn.get(i)||null,e,t,n,r,l)),!0}return!1}function ra(e){var t=Rt(e.target);if(t!==null){var n=Ht(t);if(n!==null){if(t=n.tag,t===13){if(t=Qs(n),t!==null){e.blockedOn=t,na(e.priority,function(){ea(n)});return}}else if(t===3&&n.stateNode.current.memoizedState.isDehydrated){e.blockedOn=n.tag===3?n.stateNode.containerInfo:null;return}}}e.blockedOn=null}function Fr(e){if(e.blockedOn!==null)return!1;for(var t=e.targetContainers;0<t.length;){var n=Mi(e.domEventName,e.eventSystemFlags,t[0],e.nativeEvent);if(n===null){n=e.nativeEvent;var r=new n.constructor(n.type,n);_i=r,n.target.dispatchEvent(r),_i=null}else return t=pr(n),t!==null&&So(t),e.blockedOn=n,!1;t.shift()}return!0}function gu(e,t,n){Fr(e)&&n.delete(t)}function zf(){zi=!1,ht!==null&&Fr(ht)&&(ht=null),mt!==null&&Fr(mt)&&(mt=null),gt!==null&&Fr(gt)&&(gt=null),Jn.forEach(gu),Zn.forEach(gu)}function Pn(e,t){e.blockedOn===t&&(e.blockedOn=null,zi||(zi=!0,xe.unstable_scheduleCallback(xe.unstable_NormalPriority,zf)))}function qn(e){function t(l){return Pn(l,e)}if(0<Cr.length){Pn(Cr[0],e);for(var n=1;n<Cr.length;n++){var r=Cr[n];r.blockedOn===e&&(r.blockedOn=null)}}for(ht!==null&&Pn(ht,e),mt!==null&&Pn(mt,e),gt!==null&&Pn(gt,e),Jn.forEach(t),Zn.forEach(t),n=0;n<ft.length;n++)r=ft[n],r.blockedOn===e&&(r.blockedOn=null);for(;0<ft.length&&(n=ft[0],n.blockedOn===null);)ra(n),n.blockedOn===null&&ft.shift()}var cn=it.ReactCurrentBatchConfig,qr=!0;function Mf(e,t,n,r){var l=F,i=cn.transition;cn.transition=null;try{F=1,ko(e,t,n,r)}finally{F=l,cn.transition=i}}function jf(e,t,n,r){var l=F,i=cn.transition;cn.transition=null;try{F=4,ko(e,t,n,r)}finally{F=l,cn.transition=i}}function ko(e,t,n,r){if(qr){var l=Mi(e,t,n,r);if(l===null)bl(e,t,r,br,n),mu(e,r);else if(Tf(l,e,t,n,r))r.stopPropagation();else if(mu(e,r),t&4&&-1<Pf.indexOf(e)){for(;l!==null;){var i=pr(l);if(i!==null&&bs(i),i=Mi(e,t,n,r),i===null&&bl(e,t,r,br,n),i===l)break;l=i}l!==null&&r.stopPropagation()}else bl(e,t,r,null,n)}}var br=null;function Mi(e,t,n,r){if(br=null,e=go(r),e=Rt(e),e!==null)if(t=Ht(e),t===null)e=null;else if(n=t.tag,n===13){if(e=Qs(t),e!==null)return e;e=null}else if(n===3){if(t.stateNode.current.memoizedState.isDehydrated)return t.tag===3?t.stateNode.containerInfo:null;e=null}else t!==e&&(e=null);return br=e,null}function la(e){switch(e){case"cancel":case"click":case"close":case"contextmenu":case"copy":case"cut":case"auxclick":case"dblclick":case"dragend":case"dragstart":case"drop":case"focusin":case"focusout":case"input":case"invalid":case"keydown":case"keypress":case"keyup":case"mousedown":case"mouseup":case"paste":case"pause":case"play":case"pointercancel":case"pointerdown":case"pointerup":case"ratechange":case"reset":case"resize":case"seeked":case"submit":case"touchcancel":case"touchend":case"touchstart":case"volumechange":case"change":case"selectionchange":case"textInput":case"compositionstart":case"compositionend":case"compositionupdate":case"beforeblur":case"afterblur":case"beforeinput":case"blur":case"fullscreenchange":case"focus":case"hashchange":case"popstate":case"select":case"selectstart":return 1;case"drag":case"dragenter":case"dragexit":case"dragleave":case"dragover":case"mousemove":case"mouseout":case"mouseover":case"pointermove":case"pointerout":case"pointerover":case"scroll":case"toggle":case"touchmove":case"wheel":case"mouseenter":case"mouseleave":case"pointerenter":case"pointerleave":return 4;case"message":switch(wf()){case yo:return 1;case Gs:return 4;case Jr:case Sf:return 16;case Js:return 536870912;default:return 16}default:return 16}}var pt=null,Eo=null,Ur=null;function ia(){if(Ur)return Ur;var e,t=Eo,n=t.length,r,l="value"in pt?pt.value:pt.textContent,i=l.length;for(e=0;e<n&&t[e]===l[e];e++);var o=n-e;for(r=1;r<=o&&t[n-r]===l[i-r];r++);return Ur=l.slice(e,1<r?1-r:void 0)}function Vr(e){var t=e.keyCode;return"charCode"in e?(e=e.charCode,e===0&&t===13&&(e=13)):e=t,e===10&&(e=13),32<=e||e===13?e:0}function _r(){return!0}function yu(){return!1}function _e(e){function t(n,r,l,i,o){this._reactName=n,this._targetInst=l,this.type=r,this.nativeEvent=i,this.target=o,this.currentTarget=null;for(var u in e)e.hasOwnProperty(u)&&(n=e[u],this[u]=n?n(i):i[u]);return this.isDefaultPrevented=(i.defaultPrevented!=null?i.defaultPrevented:i.returnValue===!1)?_r:yu,this.isPropagationStopped=yu,this}return Y(t.prototype,{preventDefault:function(){this.defaultPrevented=!0;var n=this.nativeEvent;n&&(n.preventDefault?n.preventDefault():typeof n.returnValue!="unknown"&&(n.returnValue=!1),this.isDefaultPrevented=_r)},stopPropagation:function(){var n=this.nativeEvent;n&&(n.stopPropagation?n.stopPropagation():typeof n.cancelBubble!="unknown"&&(n.cancelBubble=!0),this.isPropagationStopped=_r)},persist:function(){},isPersistent:_r}),t}var kn={eventPhase:0,bubbles:0,cancelable:0,timeStamp:function(e){return e.timeStamp||Date.now()},defaultPrevented:0,isTrusted:0},xo=_e(kn),dr=Y({},kn,{view:0,detail:0}),Rf=_e(dr),Hl,Ql,Tn,Sl=Y({},dr,{screenX:0,screenY:0,clientX:0,clientY:0,pageX:0,pageY:0,ctrlKey:0,shiftKey:0,altKey:0,metaKey:0,getModifierState:Co,button:0,buttons:0,relatedTarget:function(e){return e.relatedTarget===void 0?e.fromElement===e.srcElement?e.toElement:e.fromElement:e.relatedTarget},movementX:function(e){return"movementX"in e?e.movementX:(e!==Tn&&(Tn&&e.type==="mousemove"?(Hl=e.screenX-Tn.screenX,Ql=e.screenY-Tn.screenY):Ql=Hl=0,Tn=e),Hl)},movementY:function(e){return"movementY"in e?e.movementY:Ql}}),wu=_e(Sl),Df=Y({},Sl,{dataTransfer:0}),If=_e(Df),Of=Y({},dr,{relatedTarget:0}),Yl=_e(Of),Ff=Y({},kn,{animationName:0,elapsedTime:0,pseudoElement:0}),Uf=_e(Ff),Vf=Y({},kn,{clipboardData:function(e){return"clipboardData"in e?e.clipboardData:window.clipboardData}}),Af=_e(Vf),$f=Y({},kn,{data:0}),Su=_e($f),Wf={Esc:"Escape",Spacebar:" ",Left:"ArrowLeft",Up:"ArrowUp",Right:"ArrowRight",Down:"ArrowDown",Del:"Delete",Win:"OS",Menu:"ContextMenu",Apps:"ContextMenu",Scroll:"ScrollLock",MozPrintableKey:"Unidentified"},Bf={8:"Backspace",9:"Tab",12:"Clear",13:"Enter",16:"Shift",17:"Control",18:"Alt",19:"Pause",20:"CapsLock",27:"Escape",32:" ",33:"PageUp",34:"PageDown",35:"End",36:"Home",37:"ArrowLeft",38:"ArrowUp",39:"ArrowRight",40:"ArrowDown",45:"Insert",46:"Delete",112:"F1",113:"F2",114:"F3",115:"F4",116:"F5",117:"F6",118:"F7",119:"F8",120:"F9",121:"F10",122:"F11",123:"F12",144:"NumLock",145:"ScrollLock",224:"Meta"},Hf={Alt:"altKey",Control:"ctrlKey",Meta:"metaKey",Shift:"shiftKey"};function Qf(e){var t=this.nativeEvent;return t.getModifierState?t.getModifierState(e):(e=Hf[e])?!!t[e]:!1}function Co(){return Qf}var Yf=Y({},dr,{key:function(e){if(e.key){var t=Wf[e.key]||e.key;if(t!=="Unidentified")return t}return e.type==="keypress"?(e=Vr(e),e===13?"Enter":String.fromCharCode(e)):e.type==="keydown"||e.type==="keyup"?Bf[e.keyCode]||"Unidentified":""},code:0,location:0,ctrlKey:0,shiftKey:0,altKey:0,metaKey:0,repeat:0,locale:0,getModifierState:Co,charCode:function(e){return e.type==="keypress"?Vr(e):0},keyCode:function(e){return e.type==="keydown"||e.type==="keyup"?e.keyCode:0},which:function(e){return e.type==="keypress"?Vr(e):e.type==="keydown"||e.type==="keyup"?e.keyCode:0}}),Kf=_e(Yf),Xf=Y({},Sl,{pointerId:0,width:0,height:0,pressure:0,tangentialPressure:0,tiltX:0,tiltY:0,twist:0,pointerType:0,isPrimary:0}),ku=_e(Xf),Gf=Y({},dr,{touches:0,targetTouches:0,changedTouches:0,altKey:0,metaKey:0,ctrlKey:0,shiftKey:0,getModifierState:Co}),Jf=_e(Gf),Zf=Y({},kn,{propertyName:0,elapsedTime:0,pseudoElement:0}),qf=_e(Zf),bf=Y({},Sl,{deltaX:function(e){return"deltaX"in e?e.deltaX:"wheelDeltaX"in e?-e.wheelDeltaX:0},deltaY:function(e){return"deltaY"in e?e.deltaY:"wheelDeltaY"in e?-e.wheelDeltaY:"wheelDelta"in e?-e.wheelDelta:0},deltaZ:0,deltaMode:0}),ed=_e(bf),td=[9,13,27,32],_o=tt&&"CompositionEvent"in window,Vn=null;tt&&"documentMode"in document&&(Vn=document.documentMode);var nd=tt&&"TextEvent"in window&&!Vn,oa=tt&&(!_o||Vn&&8<Vn&&11>=Vn),Eu=" ",xu=!1;function ua(e,t){switch(e){case"keyup":return td.indexOf(t.keyCode)!==-1;case"keydown":return t.keyCode!==229;case"keypress":case"mousedown":case"focusout":return!0;default:return!1}}function sa(e){return e=e.detail,typeof e=="object"&&"data"in e?e.data:null}var Jt=!1;function rd(e,t){switch(e){case"compositionend":return sa(t);case"keypress":return t.which!==32?null:(xu=!0,Eu);case"textInput":return e=t.data,e===Eu&&xu?null:e;default:return null}}function ld(e,t){if(Jt)return e==="compositionend"||!_o&&ua(e,t)?(e=ia(),Ur=Eo=pt=null,Jt=!1,e):null;switch(e){case"paste":return null;case"keypress":if(!(t.ctrlKey||t.altKey||t.metaKey)||t.ctrlKey&&t.altKey){if(t.char&&1<t.char.length)return t.char;if(t.which)return String.fromCharCode(t.which)}return null;case"compositionend":return oa&&t.locale!=="ko"?null:t.data;default:return null}}var id={color:!0,date:!0,datetime:!0,"datetime-local":!0,email:!0,month:!0,number:!0,password:!0,range:!0,search:!0,tel:!0,text:!0,time:!0,url:!0,week:!0};function Cu(e){var t=e&&e.nodeName&&e.nodeName.toLowerCase();return t==="input"?!!id[e.type]:t==="textarea"}function aa(e,t,n,r){As(r),t=el(t,"onChange"),0<t.length&&(n=new xo("onChange","change",null,n,r),e.push({event:n,listeners:t}))}var An=null,bn=null;function od(e){Sa(e,0)}function kl(e){var t=bt(e);if(Rs(t))return e}function ud(e,t){if(e==="change")return t}var ca=!1;if(tt){var Kl;if(tt){var Xl="oninput"in document;if(!Xl){var _u=document.createElement("div");_u.setAttribute("oninput","return;"),Xl=typeof _u.oninput=="function"}Kl=Xl}else Kl=!1;ca=Kl&&(!document.documentMode||9<document.documentMode)}function Nu(){An&&(An.detachEvent("onpropertychange",fa),bn=An=null)}function fa(e){if(e.propertyName==="value"&&kl(bn)){var t=[];aa(t,bn,e,go(e)),Hs(od,t)}}function sd(e,t,n){e==="focusin"?(Nu(),An=t,bn=n,An.attachEvent("onpropertychange",fa)):e==="focusout"&&Nu()}function ad(e){if(e==="selectionchange"||e==="keyup"||e==="keydown")return kl(bn)}function cd(e,t){if(e==="click")return kl(t)}function fd(e,t){if(e==="input"||e==="change")return kl(t)}function dd(e,t){return e===t&&(e!==0||1/e===1/t)||e!==e&&t!==t}var We=typeof Object.is=="function"?Object.is:dd;function er(e,t){if(We(e,t))return!0;if(typeof e!="object"||e===null||typeof t!="object"||t===null)return!1;var n=Object.keys(e),r=Object.keys(t);if(n.length!==r.length)return!1;for(r=0;r<n.length;r++){var l=n[r];if(!pi.call(t,l)||!We(e[l],t[l]))return!1}return!0}function Lu(e){for(;e&&e.firstChild;)e=e.firstChild;return e}function Pu(e,t){var n=Lu(e);e=0;for(var r;n;){if(n.nodeType===3){if(r=e+n.textContent.length,e<=t&&r>=t)return{node:n,offset:t-e};e=r}e:{for(;n;){if(n.nextSibling){n=n.nextSibling;break e}n=n.parentNode}n=void 0}n=Lu(n)}}function da(e,t){return e&&t?e===t?!0:e&&e.nodeType===3?!1:t&&t.nodeType===3?da(e,t.parentNode):"contains"in e?e.contains(t):e.compareDocumentPosition?!!(e.compareDocumentPosition(t)&16):!1:!1}function pa(){for(var e=window,t=Kr();t instanceof e.HTMLIFrameElement;){try{var n=typeof t.contentWindow.location.href=="string"}catch{n=!1}if(n)e=t.contentWindow;else break;t=Kr(e.document)}return t}function No(e){var t=e&&e.nodeName&&e.nodeName.toLowerCase();return t&&(t==="input"&&(e.type==="text"||e.type==="search"||e.type==="tel"||e.type==="url"||e.type==="password")||t==="textarea"||e.contentEditable==="true")}function pd(e){var t=pa(),n=e.focusedElem,r=e.selectionRange;if(t!==n&&n&&n.ownerDocument&&da(n.ownerDocument.documentElement,n)){if(r!==null&&No(n)){if(t=r.start,e=r.end,e===void 0&&(e=t),"selectionStart"in n)n.selectionStart=t,n.selectionEnd=Math.min(e,n.value.length);else if(e=(t=n.ownerDocument||document)&&t.defaultView||window,e.getSelection){e=e.getSelection();var l=n.textContent.length,i=Math.min(r.start,l);r=r.end===void 0?i:Math.min(r.end,l),!e.extend&&i>r&&(l=r,r=i,i=l),l=Pu(n,i);var o=Pu(n,r);l&&o&&(e.rangeCount!==1||e.anchorNode!==l.node||e.anchorOffset!==l.offset||e.focusNode!==o.node||e.focusOffset!==o.offset)&&(t=t.createRange(),t.setStart(l.node,l.offset),e.removeAllRanges(),i>r?(e.addRange(t),e.extend(o.node,o.offset)):(t.setEnd(o.node,o.offset),e.addRange(t)))}}for(t=[],e=n;e=e.parentNode;)e.nodeType===1&&t.push({element:e,left:e.scrollLeft,top:e.scrollTop});for(typeof n.focus=="function"&&n.focus(),n=0;n<t.length;n++)e=t[n],e.element.scrollLeft=e.left,e.element.scrollTop=e.top}}var vd=tt&&"documentMode"in document&&11>=document.documentMode,Zt=null,ji=null,$n=null,Ri=!1;function Tu(e,t,n){var r=n.window===n?n.document:n.nodeType===9?n:n.ownerDocument;Ri||Zt==null||Zt!==Kr(r)||(r=Zt,"selectionStart"in r&&No(r)?r={start:r.selectionStart,end:r.selectionEnd}:(r=(r.ownerDocument&&r.ownerDocument.defaultView||window).getSelection(),r={anchorNode:r.anchorNode,anchorOffset:r.anchorOffset,focusNode:r.focusNode,focusOffset:r.focusOffset}),$n&&er($n,r)||($n=r,r=el(ji,"onSelect"),0<r.length&&(t=new xo("onSelect","select",null,t,n),e.push({event:t,listeners:r}),t.target=Zt)))}function Nr(e,t){var n={};return n[e.toLowerCase()]=t.toLowerCase(),n["Webkit"+e]="webkit"+t,n["Moz"+e]="moz"+t,n}var qt={animationend:Nr("Animation","AnimationEnd"),animationiteration:Nr("Animation","AnimationIteration"),animationstart:Nr("Animation","AnimationStart"),transitionend:Nr("Transition","TransitionEnd")},Gl={},va={};tt&&(va=document.createElement("div").style,"AnimationEvent"in window||(delete qt.animationend.animation,delete qt.animationiteration.animation,delete qt.animationstart.animation),"TransitionEvent"in window||delete qt.transitionend.transition);function El(e){if(Gl[e])return Gl[e];if(!qt[e])return e;var t=qt[e],n;for(n in t)if(t.hasOwnProperty(n)&&n in va)return Gl[e]=t[n];return e}var ha=El("animationend"),ma=El("animationiteration"),ga=El("animationstart"),ya=El("transitionend"),wa=new Map,zu="abort auxClick cancel canPlay canPlayThrough click close contextMenu copy cut drag dragEnd dragEnter dragExit dragLeave dragOver dragStart drop durationChange emptied encrypted ended error gotPointerCapture input invalid keyDown keyPress keyUp load loadedData loadedMetadata loadStart lostPointerCapture mouseDown mouseMove mouseOut mouseOver mouseUp paste pause play playing pointerCancel pointerDown pointerMove pointerOut pointerOver pointerUp progress rateChange reset resize seeked seeking stalled submit suspend timeUpdate touchCancel touchEnd touchStart volumeChange scroll toggle touchMove waiting wheel".split(" ");function _t(e,t){wa.set(e,t),Bt(t,[e])}for(var Jl=0;Jl<zu.length;Jl++){var Zl=zu[Jl],hd=Zl.toLowerCase(),md=Zl[0].toUpperCase()+Zl.slice(1);_t(hd,"on"+md)}_t(ha,"onAnimationEnd");_t(ma,"onAnimationIteration");_t(ga,"onAnimationStart");_t("dblclick","onDoubleClick");_t("focusin","onFocus");_t("focusout","onBlur");_t(ya,"onTransitionEnd");pn("onMouseEnter",["mouseout","mouseover"]);pn("onMouseLeave",["mouseout","mouseover"]);pn("onPointerEnter",["pointerout","pointerover"]);pn("onPointerLeave",["pointerout","pointerover"]);Bt("onChange","change click focusin focusout input keydown keyup selectionchange".split(" "));Bt("onSelect","focusout contextmenu dragend focusin keydown keyup mousedown mouseup selectionchange".split(" "));Bt("onBeforeInput",["compositionend","keypress","textInput","paste"]);Bt("onCompositionEnd","compositionend focusout keydown keypress keyup mousedown".split(" "));Bt("onCompositionStart","compositionstart focusout keydown keypress keyup mousedown".split(" "));Bt("onCompositionUpdate","compositionupdate focusout keydown keypress keyup mousedown".split(" "));var On="abort canplay canplaythrough durationchange emptied encrypted ended error loadeddata loadedmetadata loadstart pause play playing progress ratechange resize seeked seeking stalled suspend timeupdate volumechange waiting".split(" "),gd=new Set("cancel close invalid load scroll toggle".split(" ").concat(On));function Mu(e,t,n){var r=e.type||"unknown-event";e.currentTarget=n,hf(r,t,void 0,e),e.currentTarget=null}function Sa(e,t){t=(t&4)!==0;for(var n=0;n<e.length;n++){var r=e[n],l=r.event;r=r.listeners;e:{var i=void 0;if(t)for(var o=r.length-1;0<=o;o--){var u=r[o],s=u.instance,f=u.currentTarget;if(u=u.listener,s!==i&&l.isPropagationStopped())break e;Mu(l,u,f),i=s}else for(o=0;o<r.length;o++){if(u=r[o],s=u.instance,f=u.currentTarget,u=u.listener,s!==i&&l.isPropagationStopped())break e;Mu(l,u,f),i=s}}}if(Gr)throw e=Pi,Gr=!1,Pi=null,e}function A(e,t){var n=t[Ui];n===void 0&&(n=t[Ui]=new Set);var r=e+"__bubble";n.has(r)||(ka(t,e,2,!1),n.add(r))}function ql(e,t,n){var r=0;t&&(r|=4),ka(n,e,r,t)}var Lr="_reactListening"+Math.random().toString(36).slice(2);function tr(e){if(!e[Lr]){e[Lr]=!0,Ps.forEach(function(n){n!=="selectionchange"&&(gd.has(n)||ql(n,!1,e),ql(n,!0,e))});var t=e.nodeType===9?e:e.ownerDocument;t===null||t[Lr]||(t[Lr]=!0,ql("selectionchange",!1,t))}}function ka(e,t,n,r){switch(la(t)){case 1:var l=Mf;break;case 4:l=jf;break;default:l=ko}n=l.bind(null,t,n,e),l=void 0,!Li||t!=="touchstart"&&t!=="touchmove"&&t!=="wheel"||(l=!0),r?l!==void 0?e.addEventListener(t,n,{capture:!0,passive:l}):e.addEventListener(t,n,!0):l!==void 0?e.addEventListener(t,n,{passive:l}):e.addEventListener(t,n,!1)}function bl(e,t,n,r,l){var i=r;if(!(t&1)&&!(t&2)&&r!==null)e:for(;;){if(r===null)return;var o=r.tag;if(o===3||o===4){var u=r.stateNode.containerInfo;if(u===l||u.nodeType===8&&u.parentNode===l)break;if(o===4)for(o=r.return;o!==null;){var s=o.tag;if((s===3||s===4)&&(s=o.stateNode.containerInfo,s===l||s.nodeType===8&&s.parentNode===l))return;o=o.return}for(;u!==null;){if(o=Rt(u),o===null)return;if(s=o.tag,s===5||s===6){r=i=o;continue e}u=u.parentNode}}r=r.return}Hs(function(){var f=i,m=go(n),h=[];e:{var v=wa.get(e);if(v!==void 0){var S=xo,y=e;switch(e){case"keypress":if(Vr(n)===0)break e;case"keydown":case"keyup":S=Kf;break;case"focusin":y="focus",S=Yl;break;case"focusout":y="blur",S=Yl;break;case"beforeblur":case"afterblur":S=Yl;break;case"click":if(n.button===2)break e;case"auxclick":case"dblclick":case"mousedown":case"mousemove":case"mouseup":case"mouseout":case"mouseover":case"contextmenu":S=wu;break;case"drag":case"dragend":case"dragenter":case"dragexit":case"dragleave":case"dragover":case"dragstart":case"drop":S=If;break;case"touchcancel":case"touchend":case"touchmove":case"touchstart":S=Jf;break;case ha:case ma:case ga:S=Uf;break;case ya:S=qf;break;case"scroll":S=Rf;break;case"wheel":S=ed;break;case"copy":case"cut":case"paste":S=Af;break;case"gotpointercapture":case"lostpointercapture":case"pointercancel":case"pointerdown":case"pointermove":case"pointerout":case"pointerover":case"pointerup":S=ku}var k=(t&4)!==0,D=!k&&e==="scroll",d=k?v!==null?v+"Capture":null:v;k=[];for(var a=f,c;a!==null;){c=a;var p=c.stateNode;if(c.tag===5&&p!==null&&(c=p,d!==null&&(p=Gn(a,d),p!=null&&k.push(nr(a,p,c)))),D)break;a=a.return}0<k.length&&(v=new S(v,y,null,n,m),h.push({event:v,listeners:k}))}}if(!(t&7)){e:{if(v=e==="mouseover"||e==="pointerover",S=e==="mouseout"||e==="pointerout",v&&n!==_i&&(y=n.relatedTarget||n.fromElement)&&(Rt(y)||y[nt]))break e;if((S||v)&&(v=m.window===m?m:(v=m.ownerDocument)?v.defaultView||v.parentWindow:window,S?(y=n.relatedTarget||n.toElement,S=f,y=y?Rt(y):null,y!==null&&(D=Ht(y),y!==D||y.tag!==5&&y.tag!==6)&&(y=null)):(S=null,y=f),S!==y)){if(k=wu,p="onMouseLeave",d="onMouseEnter",a="mouse",(e==="pointerout"||e==="pointerover")&&(k=ku,p="onPointerLeave",d="onPointerEnter",a="pointer"),D=S==null?v:bt(S),c=y==null?v:bt(y),v=new k(p,a+"leave",S,n,m),v.target=D,v.relatedTarget=c,p=null,Rt(m)===f&&(k=new k(d,a+"enter",y,n,m),k.target=c,k.relatedTarget=D,p=k),D=p,S&&y)t:{for(k=S,d=y,a=0,c=k;c;c=Kt(c))a++;for(c=0,p=d;p;p=Kt(p))c++;for(;0<a-c;)k=Kt(k),a--;for(;0<c-a;)d=Kt(d),c--;for(;a--;){if(k===d||d!==null&&k===d.alternate)break t;k=Kt(k),d=Kt(d)}k=null}else k=null;S!==null&&ju(h,v,S,k,!1),y!==null&&D!==null&&ju(h,D,y,k,!0)}}e:{if(v=f?bt(f):window,S=v.nodeName&&v.nodeName.toLowerCase(),S==="select"||S==="input"&&v.type==="file")var C=ud;else if(Cu(v))if(ca)C=fd;else{C=ad;var P=sd}else(S=v.nodeName)&&S.toLowerCase()==="input"&&(v.type==="checkbox"||v.type==="radio")&&(C=cd);if(C&&(C=C(e,f))){aa(h,C,n,m);break e}P&&P(e,v,f),e==="focusout"&&(P=v._wrapperState)&&P.controlled&&v.type==="number"&&Si(v,"number",v.value)}switch(P=f?bt(f):window,e){case"focusin":(Cu(P)||P.contentEditable==="true")&&(Zt=P,ji=f,$n=null);break;case"focusout":$n=ji=Zt=null;break;case"mousedown":Ri=!0;break;case"contextmenu":case"mouseup":case"dragend":Ri=!1,Tu(h,n,m);break;case"selectionchange":if(vd)break;case"keydown":case"keyup":Tu(h,n,m)}var N;if(_o)e:{switch(e){case"compositionstart":var E="onCompositionStart";break e;case"compositionend":E="onCompositionEnd";break e;case"compositionupdate":E="onCompositionUpdate";break e}E=void 0}else Jt?ua(e,n)&&(E="onCompositionEnd"):e==="keydown"&&n.keyCode===229&&(E="onCompositionStart");E&&(oa&&n.locale!=="ko"&&(Jt||E!=="onCompositionStart"?E==="onCompositionEnd"&&Jt&&(N=ia()):(pt=m,Eo="value"in pt?pt.value:pt.textContent,Jt=!0)),P=el(f,E),0<P.length&&(E=new Su(E,e,null,n,m),h.push({event:E,listeners:P}),N?E.data=N:(N=sa(n),N!==null&&(E.data=N)))),(N=nd?rd(e,n):ld(e,n))&&(f=el(f,"onBeforeInput"),0<f.length&&(m=new Su("onBeforeInput","beforeinput",null,n,m),h.push({event:m,listeners:f}),m.data=N))}Sa(h,t)})}function nr(e,t,n){return{instance:e,listener:t,currentTarget:n}}function el(e,t){for(var n=t+"Capture",r=[];e!==null;){var l=e,i=l.stateNode;l.tag===5&&i!==null&&(l=i,i=Gn(e,n),i!=null&&r.unshift(nr(e,i,l)),i=Gn(e,t),i!=null&&r.push(nr(e,i,l))),e=e.return}return r}function Kt(e){if(e===null)return null;do e=e.return;while(e&&e.tag!==5);return e||null}function ju(e,t,n,r,l){for(var i=t._reactName,o=[];n!==null&&n!==r;){var u=n,s=u.alternate,f=u.stateNode;if(s!==null&&s===r)break;u.tag===5&&f!==null&&(u=f,l?(s=Gn(n,i),s!=null&&o.unshift(nr(n,s,u))):l||(s=Gn(n,i),s!=null&&o.push(nr(n,s,u)))),n=n.return}o.length!==0&&e.push({event:t,listeners:o})}var yd=/\r\n?/g,wd=/\u0000|\uFFFD/g;function Ru(e){return(typeof e=="string"?e:""+e).replace(yd,`
-`).replace(wd,"")}function Pr(e,t,n){if(t=Ru(t),Ru(e)!==t&&n)throw Error(g(425))}function tl(){}var Di=null,Ii=null;function Oi(e,t){return e==="textarea"||e==="noscript"||typeof t.children=="string"||typeof t.children=="number"||typeof t.dangerouslySetInnerHTML=="object"&&t.dangerouslySetInnerHTML!==null&&t.dangerouslySetInnerHTML.__html!=null}var Fi=typeof setTimeout=="function"?setTimeout:void 0,Sd=typeof clearTimeout=="function"?clearTimeout:void 0,Du=typeof Promise=="function"?Promise:void 0,kd=typeof queueMicrotask=="function"?queueMicrotask:typeof Du<"u"?function(e){return Du.resolve(null).then(e).catch(Ed)}:Fi;function Ed(e){setTimeout(function(){throw e})}function ei(e,t){var n=t,r=0;do{var l=n.nextSibling;if(e.removeChild(n),l&&l.nodeType===8)if(n=l.data,n==="/$"){if(r===0){e.removeChild(l),qn(t);return}r--}else n!=="$"&&n!=="$?"&&n!=="$!"||r++;n=l}while(n);qn(t)}function yt(e){for(;e!=null;e=e.nextSibling){var t=e.nodeType;if(t===1||t===3)break;if(t===8){if(t=e.data,t==="$"||t==="$!"||t==="$?")break;if(t==="/$")return null}}return e}function Iu(e){e=e.previousSibling;for(var t=0;e;){if(e.nodeType===8){var n=e.data;if(n==="$"||n==="$!"||n==="$?"){if(t===0)return e;t--}else n==="/$"&&t++}e=e.previousSibling}return null}var En=Math.random().toString(36).slice(2),Ye="__reactFiber$"+En,rr="__reactProps$"+En,nt="__reactContainer$"+En,Ui="__reactEvents$"+En,xd="__reactListeners$"+En,Cd="__reactHandles$"+En;function Rt(e){var t=e[Ye];if(t)return t;for(var n=e.parentNode;n;){if(t=n[nt]||n[Ye]){if(n=t.alternate,t.child!==null||n!==null&&n.child!==null)for(e=Iu(e);e!==null;){if(n=e[Ye])return n;e=Iu(e)}return t}e=n,n=e.parentNode}return null}function pr(e){return e=e[Ye]||e[nt],!e||e.tag!==5&&e.tag!==6&&e.tag!==13&&e.tag!==3?null:e}function bt(e){if(e.tag===5||e.tag===6)return e.stateNode;throw Error(g(33))}function xl(e){return e[rr]||null}var Vi=[],en=-1;function Nt(e){return{current:e}}function $(e){0>en||(e.current=Vi[en],Vi[en]=null,en--)}function V(e,t){en++,Vi[en]=e.current,e.current=t}var Ct={},se=Nt(Ct),me=Nt(!1),Ut=Ct;function vn(e,t){var n=e.type.contextTypes;if(!n)return Ct;var r=e.stateNode;if(r&&r.__reactInternalMemoizedUnmaskedChildContext===t)return r.__reactInternalMemoizedMaskedChildContext;var l={},i;for(i in n)l[i]=t[i];return r&&(e=e.stateNode,e.__reactInternalMemoizedUnmaskedChildContext=t,e.__reactInternalMemoizedMaskedChildContext=l),l}function ge(e){return e=e.childContextTypes,e!=null}function nl(){$(me),$(se)}function Ou(e,t,n){if(se.current!==Ct)throw Error(g(168));V(se,t),V(me,n)}function Ea(e,t,n){var r=e.stateNode;if(t=t.childContextTypes,typeof r.getChildContext!="function")return n;r=r.getChildContext();for(var l in r)if(!(l in t))throw Error(g(108,sf(e)||"Unknown",l));return Y({},n,r)}function rl(e){return e=(e=e.stateNode)&&e.__reactInternalMemoizedMergedChildContext||Ct,Ut=se.current,V(se,e),V(me,me.current),!0}function Fu(e,t,n){var r=e.stateNode;if(!r)throw Error(g(169));n?(e=Ea(e,t,Ut),r.__reactInternalMemoizedMergedChildContext=e,$(me),$(se),V(se,e)):$(me),V(me,n)}var Ze=null,Cl=!1,ti=!1;function xa(e){Ze===null?Ze=[e]:Ze.push(e)}function _d(e){Cl=!0,xa(e)}function Lt(){if(!ti&&Ze!==null){ti=!0;var e=0,t=F;try{var n=Ze;for(F=1;e<n.length;e++){var r=n[e];do r=r(!0);while(r!==null)}Ze=null,Cl=!1}catch(l){throw Ze!==null&&(Ze=Ze.slice(e+1)),Xs(yo,Lt),l}finally{F=t,ti=!1}}return null}var tn=[],nn=0,ll=null,il=0,Ne=[],Le=0,Vt=null,qe=1,be="";function Mt(e,t){tn[nn++]=il,tn[nn++]=ll,ll=e,il=t}function Ca(e,t,n){Ne[Le++]=qe,Ne[Le++]=be,Ne[Le++]=Vt,Vt=e;var r=qe;e=be;var l=32-Ae(r)-1;r&=~(1<<l),n+=1;var i=32-Ae(t)+l;if(30<i){var o=l-l%5;i=(r&(1<<o)-1).toString(32),r>>=o,l-=o,qe=1<<32-Ae(t)+l|n<<l|r,be=i+e}else qe=1<<i|n<<l|r,be=e}function Lo(e){e.return!==null&&(Mt(e,1),Ca(e,1,0))}function Po(e){for(;e===ll;)ll=tn[--nn],tn[nn]=null,il=tn[--nn],tn[nn]=null;for(;e===Vt;)Vt=Ne[--Le],Ne[Le]=null,be=Ne[--Le],Ne[Le]=null,qe=Ne[--Le],Ne[Le]=null}var Ee=null,ke=null,W=!1,Ue=null;function _a(e,t){var n=Pe(5,null,null,0);n.elementType="DELETED",n.stateNode=t,n.return=e,t=e.deletions,t===null?(e.deletions=[n],e.flags|=16):t.push(n)}function Uu(e,t){switch(e.tag){case 5:var n=e.type;return t=t.nodeType!==1||n.toLowerCase()!==t.nodeName.toLowerCase()?null:t,t!==null?(e.stateNode=t,Ee=e,ke=yt(t.firstChild),!0):!1;case 6:return t=e.pendingProps===""||t.nodeType!==3?null:t,t!==null?(e.stateNode=t,Ee=e,ke=null,!0):!1;case 13:return t=t.nodeType!==8?null:t,t!==null?(n=Vt!==null?{id:qe,overflow:be}:null,e.memoizedState={dehydrated:t,treeContext:n,retryLane:1073741824},n=Pe(18,null,null,0),n.stateNode=t,n.return=e,e.child=n,Ee=e,ke=null,!0):!1;default:return!1}}function Ai(e){return(e.mode&1)!==0&&(e.flags&128)===0}function $i(e){if(W){var t=ke;if(t){var n=t;if(!Uu(e,t)){if(Ai(e))throw Error(g(418));t=yt(n.nextSibling);var r=Ee;t&&Uu(e,t)?_a(r,n):(e.flags=e.flags&-4097|2,W=!1,Ee=e)}}else{if(Ai(e))throw Error(g(418));e.flags=e.flags&-4097|2,W=!1,Ee=e}}}function Vu(e){for(e=e.return;e!==null&&e.tag!==5&&e.tag!==3&&e.tag!==13;)e=e.return;Ee=e}function Tr(e){if(e!==Ee)return!1;if(!W)return Vu(e),W=!0,!1;var t;if((t=e.tag!==3)&&!(t=e.tag!==5)&&(t=e.type,t=t!=="head"&&t!=="body"&&!Oi(e.type,e.memoizedProps)),t&&(t=ke)){if(Ai(e))throw Na(),Error(g(418));for(;t;)_a(e,t),t=yt(t.nextSibling)}if(Vu(e),e.tag===13){if(e=e.memoizedState,e=e!==null?e.dehydrated:null,!e)throw Error(g(317));e:{for(e=e.nextSibling,t=0;e;){if(e.nodeType===8){var n=e.data;if(n==="/$"){if(t===0){ke=yt(e.nextSibling);break e}t--}else n!=="$"&&n!=="$!"&&n!=="$?"||t++}e=e.nextSibling}ke=null}}else ke=Ee?yt(e.stateNode.nextSibling):null;return!0}function Na(){for(var e=ke;e;)e=yt(e.nextSibling)}function hn(){ke=Ee=null,W=!1}function To(e){Ue===null?Ue=[e]:Ue.push(e)}var Nd=it.ReactCurrentBatchConfig;function zn(e,t,n){if(e=n.ref,e!==null&&typeof e!="function"&&typeof e!="object"){if(n._owner){if(n=n._owner,n){if(n.tag!==1)throw Error(g(309));var r=n.stateNode}if(!r)throw Error(g(147,e));var l=r,i=""+e;return t!==null&&t.ref!==null&&typeof t.ref=="function"&&t.ref._stringRef===i?t.ref:(t=function(o){var u=l.refs;o===null?delete u[i]:u[i]=o},t._stringRef=i,t)}if(typeof e!="string")throw Error(g(284));if(!n._owner)throw Error(g(290,e))}return e}function zr(e,t){throw e=Object.prototype.toString.call(t),Error(g(31,e==="[object Object]"?"object with keys {"+Object.keys(t).join(", ")+"}":e))}function Au(e){var t=e._init;return t(e._payload)}function La(e){function t(d,a){if(e){var c=d.deletions;c===null?(d.deletions=[a],d.flags|=16):c.push(a)}}function n(d,a){if(!e)return null;for(;a!==null;)t(d,a),a=a.sibling;return null}function r(d,a){for(d=new Map;a!==null;)a.key!==null?d.set(a.key,a):d.set(a.index,a),a=a.sibling;return d}function l(d,a){return d=Et(d,a),d.index=0,d.sibling=null,d}function i(d,a,c){return d.index=c,e?(c=d.alternate,c!==null?(c=c.index,c<a?(d.flags|=2,a):c):(d.flags|=2,a)):(d.flags|=1048576,a)}function o(d){return e&&d.alternate===null&&(d.flags|=2),d}function u(d,a,c,p){return a===null||a.tag!==6?(a=si(c,d.mode,p),a.return=d,a):(a=l(a,c),a.return=d,a)}function s(d,a,c,p){var C=c.type;return C===Gt?m(d,a,c.props.children,p,c.key):a!==null&&(a.elementType===C||typeof C=="object"&&C!==null&&C.$$typeof===at&&Au(C)===a.type)?(p=l(a,c.props),p.ref=zn(d,a,c),p.return=d,p):(p=Yr(c.type,c.key,c.props,null,d.mode,p),p.ref=zn(d,a,c),p.return=d,p)}function f(d,a,c,p){return a===null||a.tag!==4||a.stateNode.containerInfo!==c.containerInfo||a.stateNode.implementation!==c.implementation?(a=ai(c,d.mode,p),a.return=d,a):(a=l(a,c.children||[]),a.return=d,a)}function m(d,a,c,p,C){return a===null||a.tag!==7?(a=Ft(c,d.mode,p,C),a.return=d,a):(a=l(a,c),a.return=d,a)}function h(d,a,c){if(typeof a=="string"&&a!==""||typeof a=="number")return a=si(""+a,d.mode,c),a.return=d,a;if(typeof a=="object"&&a!==null){switch(a.$$typeof){case wr:return c=Yr(a.type,a.key,a.props,null,d.mode,c),c.ref=zn(d,null,a),c.return=d,c;case Xt:return a=ai(a,d.mode,c),a.return=d,a;case at:var p=a._init;return h(d,p(a._payload),c)}if(Dn(a)||_n(a))return a=Ft(a,d.mode,c,null),a.return=d,a;zr(d,a)}return null}function v(d,a,c,p){var C=a!==null?a.key:null;if(typeof c=="string"&&c!==""||typeof c=="number")return C!==null?null:u(d,a,""+c,p);if(typeof c=="object"&&c!==null){switch(c.$$typeof){case wr:return c.key===C?s(d,a,c,p):null;case Xt:return c.key===C?f(d,a,c,p):null;case at:return C=c._init,v(d,a,C(c._payload),p)}if(Dn(c)||_n(c))return C!==null?null:m(d,a,c,p,null);zr(d,c)}return null}function S(d,a,c,p,C){if(typeof p=="string"&&p!==""||typeof p=="number")return d=d.get(c)||null,u(a,d,""+p,C);if(typeof p=="object"&&p!==null){switch(p.$$typeof){case wr:return d=d.get(p.key===null?c:p.key)||null,s(a,d,p,C);case Xt:return d=d.get(p.key===null?c:p.key)||null,f(a,d,p,C);case at:var P=p._init;return S(d,a,c,P(p._payload),C)}if(Dn(p)||_n(p))return d=d.get(c)||null,m(a,d,p,C,null);zr(a,p)}return null}function y(d,a,c,p){for(var C=null,P=null,N=a,E=a=0,T=null;N!==null&&E<c.length;E++){N.index>E?(T=N,N=null):T=N.sibling;var M=v(d,N,c[E],p);if(M===null){N===null&&(N=T);break}e&&N&&M.alternate===null&&t(d,N),a=i(M,a,E),P===null?C=M:P.sibling=M,P=M,N=T}if(E===c.length)return n(d,N),W&&Mt(d,E),C;if(N===null){for(;E<c.length;E++)N=h(d,c[E],p),N!==null&&(a=i(N,a,E),P===null?C=N:P.sibling=N,P=N);return W&&Mt(d,E),C}for(N=r(d,N);E<c.length;E++)T=S(N,d,E,c[E],p),T!==null&&(e&&T.alternate!==null&&N.delete(T.key===null?E:T.key),a=i(T,a,E),P===null?C=T:P.sibling=T,P=T);return e&&N.forEach(function(we){return t(d,we)}),W&&Mt(d,E),C}function k(d,a,c,p){var C=_n(c);if(typeof C!="function")throw Error(g(150));if(c=C.call(c),c==null)throw Error(g(151));for(var P=C=null,N=a,E=a=0,T=null,M=c.next();N!==null&&!M.done;E++,M=c.next()){N.index>E?(T=N,N=null):T=N.sibling;var we=v(d,N,M.value,p);if(we===null){N===null&&(N=T);break}e&&N&&we.alternate===null&&t(d,N),a=i(we,a,E),P===null?C=we:P.sibling=we,P=we,N=T}if(M.done)return n(d,N),W&&Mt(d,E),C;if(N===null){for(;!M.done;E++,M=c.next())M=h(d,M.value,p),M!==null&&(a=i(M,a,E),P===null?C=M:P.sibling=M,P=M);return W&&Mt(d,E),C}for(N=r(d,N);!M.done;E++,M=c.next())M=S(N,d,E,M.value,p),M!==null&&(e&&M.alternate!==null&&N.delete(M.key===null?E:M.key),a=i(M,a,E),P===null?C=M:P.sibling=M,P=M);return e&&N.forEach(function(Pt){return t(d,Pt)}),W&&Mt(d,E),C}function D(d,a,c,p){if(typeof c=="object"&&c!==null&&c.type===Gt&&c.key===null&&(c=c.props.children),typeof c=="object"&&c!==null){switch(c.$$typeof){case wr:e:{for(var C=c.key,P=a;P!==null;){if(P.key===C){if(C=c.type,C===Gt){if(P.tag===7){n(d,P.sibling),a=l(P,c.props.children),a.return=d,d=a;break e}}else if(P.elementType===C||typeof C=="object"&&C!==null&&C.$$typeof===at&&Au(C)===P.type){n(d,P.sibling),a=l(P,c.props),a.ref=zn(d,P,c),a.return=d,d=a;break e}n(d,P);break}else t(d,P);P=P.sibling}c.type===Gt?(a=Ft(c.props.children,d.mode,p,c.key),a.return=d,d=a):(p=Yr(c.type,c.key,c.props,null,d.mode,p),p.ref=zn(d,a,c),p.return=d,d=p)}return o(d);case Xt:e:{for(P=c.key;a!==null;){if(a.key===P)if(a.tag===4&&a.stateNode.containerInfo===c.containerInfo&&a.stateNode.implementation===c.implementation){n(d,a.sibling),a=l(a,c.children||[]),a.return=d,d=a;break e}else{n(d,a);break}else t(d,a);a=a.sibling}a=ai(c,d.mode,p),a.return=d,d=a}return o(d);case at:return P=c._init,D(d,a,P(c._payload),p)}if(Dn(c))return y(d,a,c,p);if(_n(c))return k(d,a,c,p);zr(d,c)}return typeof c=="string"&&c!==""||typeof c=="number"?(c=""+c,a!==null&&a.tag===6?(n(d,a.sibling),a=l(a,c),a.return=d,d=a):(n(d,a),a=si(c,d.mode,p),a.return=d,d=a),o(d)):n(d,a)}return D}var mn=La(!0),Pa=La(!1),ol=Nt(null),ul=null,rn=null,zo=null;function Mo(){zo=rn=ul=null}function jo(e){var t=ol.current;$(ol),e._currentValue=t}function Wi(e,t,n){for(;e!==null;){var r=e.alternate;if((e.childLanes&t)!==t?(e.childLanes|=t,r!==null&&(r.childLanes|=t)):r!==null&&(r.childLanes&t)!==t&&(r.childLanes|=t),e===n)break;e=e.return}}function fn(e,t){ul=e,zo=rn=null,e=e.dependencies,e!==null&&e.firstContext!==null&&(e.lanes&t&&(he=!0),e.firstContext=null)}function ze(e){var t=e._currentValue;if(zo!==e)if(e={context:e,memoizedValue:t,next:null},rn===null){if(ul===null)throw Error(g(308));rn=e,ul.dependencies={lanes:0,firstContext:e}}else rn=rn.next=e;return t}var Dt=null;function Ro(e){Dt===null?Dt=[e]:Dt.push(e)}function Ta(e,t,n,r){var l=t.interleaved;return l===null?(n.next=n,Ro(t)):(n.next=l.next,l.next=n),t.interleaved=n,rt(e,r)}function rt(e,t){e.lanes|=t;var n=e.alternate;for(n!==null&&(n.lanes|=t),n=e,e=e.return;e!==null;)e.childLanes|=t,n=e.alternate,n!==null&&(n.childLanes|=t),n=e,e=e.return;return n.tag===3?n.stateNode:null}var ct=!1;function Do(e){e.updateQueue={baseState:e.memoizedState,firstBaseUpdate:null,lastBaseUpdate:null,shared:{pending:null,interleaved:null,lanes:0},effects:null}}function za(e,t){e=e.updateQueue,t.updateQueue===e&&(t.updateQueue={baseState:e.baseState,firstBaseUpdate:e.firstBaseUpdate,lastBaseUpdate:e.lastBaseUpdate,shared:e.shared,effects:e.effects})}function et(e,t){return{eventTime:e,lane:t,tag:0,payload:null,callback:null,next:null}}function wt(e,t,n){var r=e.updateQueue;if(r===null)return null;if(r=r.shared,O&2){var l=r.pending;return l===null?t.next=t:(t.next=l.next,l.next=t),r.pending=t,rt(e,n)}return l=r.interleaved,l===null?(t.next=t,Ro(r)):(t.next=l.next,l.next=t),r.interleaved=t,rt(e,n)}function Ar(e,t,n){if(t=t.updateQueue,t!==null&&(t=t.shared,(n&4194240)!==0)){var r=t.lanes;r&=e.pendingLanes,n|=r,t.lanes=n,wo(e,n)}}function $u(e,t){var n=e.updateQueue,r=e.alternate;if(r!==null&&(r=r.updateQueue,n===r)){var l=null,i=null;if(n=n.firstBaseUpdate,n!==null){do{var o={eventTime:n.eventTime,lane:n.lane,tag:n.tag,payload:n.payload,callback:n.callback,next:null};i===null?l=i=o:i=i.next=o,n=n.next}while(n!==null);i===null?l=i=t:i=i.next=t}else l=i=t;n={baseState:r.baseState,firstBaseUpdate:l,lastBaseUpdate:i,shared:r.shared,effects:r.effects},e.updateQueue=n;return}e=n.lastBaseUpdate,e===null?n.firstBaseUpdate=t:e.next=t,n.lastBaseUpdate=t}function sl(e,t,n,r){var l=e.updateQueue;ct=!1;var i=l.firstBaseUpdate,o=l.lastBaseUpdate,u=l.shared.pending;if(u!==null){l.shared.pending=null;var s=u,f=s.next;s.next=null,o===null?i=f:o.next=f,o=s;var m=e.alternate;m!==null&&(m=m.updateQueue,u=m.lastBaseUpdate,u!==o&&(u===null?m.firstBaseUpdate=f:u.next=f,m.lastBaseUpdate=s))}if(i!==null){var h=l.baseState;o=0,m=f=s=null,u=i;do{var v=u.lane,S=u.eventTime;if((r&v)===v){m!==null&&(m=m.next={eventTime:S,lane:0,tag:u.tag,payload:u.payload,callback:u.callback,next:null});e:{var y=e,k=u;switch(v=t,S=n,k.tag){case 1:if(y=k.payload,typeof y=="function"){h=y.call(S,h,v);break e}h=y;break e;case 3:y.flags=y.flags&-65537|128;case 0:if(y=k.payload,v=typeof y=="function"?y.call(S,h,v):y,v==null)break e;h=Y({},h,v);break e;case 2:ct=!0}}u.callback!==null&&u.lane!==0&&(e.flags|=64,v=l.effects,v===null?l.effects=[u]:v.push(u))}else S={eventTime:S,lane:v,tag:u.tag,payload:u.payload,callback:u.callback,next:null},m===null?(f=m=S,s=h):m=m.next=S,o|=v;if(u=u.next,u===null){if(u=l.shared.pending,u===null)break;v=u,u=v.next,v.next=null,l.lastBaseUpdate=v,l.shared.pending=null}}while(!0);if(m===null&&(s=h),l.baseState=s,l.firstBaseUpdate=f,l.lastBaseUpdate=m,t=l.shared.interleaved,t!==null){l=t;do o|=l.lane,l=l.next;while(l!==t)}else i===null&&(l.shared.lanes=0);$t|=o,e.lanes=o,e.memoizedState=h}}function Wu(e,t,n){if(e=t.effects,t.effects=null,e!==null)for(t=0;t<e.length;t++){var r=e[t],l=r.callback;if(l!==null){if(r.callback=null,r=n,typeof l!="function")throw Error(g(191,l));l.call(r)}}}var vr={},Xe=Nt(vr),lr=Nt(vr),ir=Nt(vr);function It(e){if(e===vr)throw Error(g(174));return e}function Io(e,t){switch(V(ir,t),V(lr,e),V(Xe,vr),e=t.nodeType,e){case 9:case 11:t=(t=t.documentElement)?t.namespaceURI:Ei(null,"");break;default:e=e===8?t.parentNode:t,t=e.namespaceURI||null,e=e.tagName,t=Ei(t,e)}$(Xe),V(Xe,t)}function gn(){$(Xe),$(lr),$(ir)}function Ma(e){It(ir.current);var t=It(Xe.current),n=Ei(t,e.type);t!==n&&(V(lr,e),V(Xe,n))}function Oo(e){lr.current===e&&($(Xe),$(lr))}var H=Nt(0);function al(e){for(var t=e;t!==null;){if(t.tag===13){var n=t.memoizedState;if(n!==null&&(n=n.dehydrated,n===null||n.data==="$?"||n.data==="$!"))return t}else if(t.tag===19&&t.memoizedProps.revealOrder!==void 0){if(t.flags&128)return t}else if(t.child!==null){t.child.return=t,t=t.child;continue}if(t===e)break;for(;t.sibling===null;){if(t.return===null||t.return===e)return null;t=t.return}t.sibling.return=t.return,t=t.sibling}return null}var ni=[];function Fo(){for(var e=0;e<ni.length;e++)ni[e]._workInProgressVersionPrimary=null;ni.length=0}var $r=it.ReactCurrentDispatcher,ri=it.ReactCurrentBatchConfig,At=0,Q=null,Z=null,b=null,cl=!1,Wn=!1,or=0,Ld=0;function ie(){throw Error(g(321))}function Uo(e,t){if(t===null)return!1;for(var n=0;n<t.length&&n<e.length;n++)if(!We(e[n],t[n]))return!1;return!0}function Vo(e,t,n,r,l,i){if(At=i,Q=t,t.memoizedState=null,t.updateQueue=null,t.lanes=0,$r.current=e===null||e.memoizedState===null?Md:jd,e=n(r,l),Wn){i=0;do{if(Wn=!1,or=0,25<=i)throw Error(g(301));i+=1,b=Z=null,t.updateQueue=null,$r.current=Rd,e=n(r,l)}while(Wn)}if($r.current=fl,t=Z!==null&&Z.next!==null,At=0,b=Z=Q=null,cl=!1,t)throw Error(g(300));return e}function Ao(){var e=or!==0;return or=0,e}function Qe(){var e={memoizedState:null,baseState:null,baseQueue:null,queue:null,next:null};return b===null?Q.memoizedState=b=e:b=b.next=e,b}function Me(){if(Z===null){var e=Q.alternate;e=e!==null?e.memoizedState:null}else e=Z.next;var t=b===null?Q.memoizedState:b.next;if(t!==null)b=t,Z=e;else{if(e===null)throw Error(g(310));Z=e,e={memoizedState:Z.memoizedState,baseState:Z.baseState,baseQueue:Z.baseQueue,queue:Z.queue,next:null},b===null?Q.memoizedState=b=e:b=b.next=e}return b}function ur(e,t){return typeof t=="function"?t(e):t}function li(e){var t=Me(),n=t.queue;if(n===null)throw Error(g(311));n.lastRenderedReducer=e;var r=Z,l=r.baseQueue,i=n.pending;if(i!==null){if(l!==null){var o=l.next;l.next=i.next,i.next=o}r.baseQueue=l=i,n.pending=null}if(l!==null){i=l.next,r=r.baseState;var u=o=null,s=null,f=i;do{var m=f.lane;if((At&m)===m)s!==null&&(s=s.next={lane:0,action:f.action,hasEagerState:f.hasEagerState,eagerState:f.eagerState,next:null}),r=f.hasEagerState?f.eagerState:e(r,f.action);else{var h={lane:m,action:f.action,hasEagerState:f.hasEagerState,eagerState:f.eagerState,next:null};s===null?(u=s=h,o=r):s=s.next=h,Q.lanes|=m,$t|=m}f=f.next}while(f!==null&&f!==i);s===null?o=r:s.next=u,We(r,t.memoizedState)||(he=!0),t.memoizedState=r,t.baseState=o,t.baseQueue=s,n.lastRenderedState=r}if(e=n.interleaved,e!==null){l=e;do i=l.lane,Q.lanes|=i,$t|=i,l=l.next;while(l!==e)}else l===null&&(n.lanes=0);return[t.memoizedState,n.dispatch]}function ii(e){var t=Me(),n=t.queue;if(n===null)throw Error(g(311));n.lastRenderedReducer=e;var r=n.dispatch,l=n.pending,i=t.memoizedState;if(l!==null){n.pending=null;var o=l=l.next;do i=e(i,o.action),o=o.next;while(o!==l);We(i,t.memoizedState)||(he=!0),t.memoizedState=i,t.baseQueue===null&&(t.baseState=i),n.lastRenderedState=i}return[i,r]}function ja(){}function Ra(e,t){var n=Q,r=Me(),l=t(),i=!We(r.memoizedState,l);if(i&&(r.memoizedState=l,he=!0),r=r.queue,$o(Oa.bind(null,n,r,e),[e]),r.getSnapshot!==t||i||b!==null&&b.memoizedState.tag&1){if(n.flags|=2048,sr(9,Ia.bind(null,n,r,l,t),void 0,null),ee===null)throw Error(g(349));At&30||Da(n,t,l)}return l}function Da(e,t,n){e.flags|=16384,e={getSnapshot:t,value:n},t=Q.updateQueue,t===null?(t={lastEffect:null,stores:null},Q.updateQueue=t,t.stores=[e]):(n=t.stores,n===null?t.stores=[e]:n.push(e))}function Ia(e,t,n,r){t.value=n,t.getSnapshot=r,Fa(t)&&Ua(e)}function Oa(e,t,n){return n(function(){Fa(t)&&Ua(e)})}function Fa(e){var t=e.getSnapshot;e=e.value;try{var n=t();return!We(e,n)}catch{return!0}}function Ua(e){var t=rt(e,1);t!==null&&$e(t,e,1,-1)}function Bu(e){var t=Qe();return typeof e=="function"&&(e=e()),t.memoizedState=t.baseState=e,e={pending:null,interleaved:null,lanes:0,dispatch:null,lastRenderedReducer:ur,lastRenderedState:e},t.queue=e,e=e.dispatch=zd.bind(null,Q,e),[t.memoizedState,e]}function sr(e,t,n,r){return e={tag:e,create:t,destroy:n,deps:r,next:null},t=Q.updateQueue,t===null?(t={lastEffect:null,stores:null},Q.updateQueue=t,t.lastEffect=e.next=e):(n=t.lastEffect,n===null?t.lastEffect=e.next=e:(r=n.next,n.next=e,e.next=r,t.lastEffect=e)),e}function Va(){return Me().memoizedState}function Wr(e,t,n,r){var l=Qe();Q.flags|=e,l.memoizedState=sr(1|t,n,void 0,r===void 0?null:r)}function _l(e,t,n,r){var l=Me();r=r===void 0?null:r;var i=void 0;if(Z!==null){var o=Z.memoizedState;if(i=o.destroy,r!==null&&Uo(r,o.deps)){l.memoizedState=sr(t,n,i,r);return}}Q.flags|=e,l.memoizedState=sr(1|t,n,i,r)}function Hu(e,t){return Wr(8390656,8,e,t)}function $o(e,t){return _l(2048,8,e,t)}function Aa(e,t){return _l(4,2,e,t)}function $a(e,t){return _l(4,4,e,t)}function Wa(e,t){if(typeof t=="function")return e=e(),t(e),function(){t(null)};if(t!=null)return e=e(),t.current=e,function(){t.current=null}}function Ba(e,t,n){return n=n!=null?n.concat([e]):null,_l(4,4,Wa.bind(null,t,e),n)}function Wo(){}function Ha(e,t){var n=Me();t=t===void 0?null:t;var r=n.memoizedState;return r!==null&&t!==null&&Uo(t,r[1])?r[0]:(n.memoizedState=[e,t],e)}function Qa(e,t){var n=Me();t=t===void 0?null:t;var r=n.memoizedState;return r!==null&&t!==null&&Uo(t,r[1])?r[0]:(e=e(),n.memoizedState=[e,t],e)}function Ya(e,t,n){return At&21?(We(n,t)||(n=Zs(),Q.lanes|=n,$t|=n,e.baseState=!0),t):(e.baseState&&(e.baseState=!1,he=!0),e.memoizedState=n)}function Pd(e,t){var n=F;F=n!==0&&4>n?n:4,e(!0);var r=ri.transition;ri.transition={};try{e(!1),t()}finally{F=n,ri.transition=r}}function Ka(){return Me().memoizedState}function Td(e,t,n){var r=kt(e);if(n={lane:r,action:n,hasEagerState:!1,eagerState:null,next:null},Xa(e))Ga(t,n);else if(n=Ta(e,t,n,r),n!==null){var l=ce();$e(n,e,r,l),Ja(n,t,r)}}function zd(e,t,n){var r=kt(e),l={lane:r,action:n,hasEagerState:!1,eagerState:null,next:null};if(Xa(e))Ga(t,l);else{var i=e.alternate;if(e.lanes===0&&(i===null||i.lanes===0)&&(i=t.lastRenderedReducer,i!==null))try{var o=t.lastRenderedState,u=i(o,n);if(l.hasEagerState=!0,l.eagerState=u,We(u,o)){var s=t.interleaved;s===null?(l.next=l,Ro(t)):(l.next=s.next,s.next=l),t.interleaved=l;return}}catch{}finally{}n=Ta(e,t,l,r),n!==null&&(l=ce(),$e(n,e,r,l),Ja(n,t,r))}}function Xa(e){var t=e.alternate;return e===Q||t!==null&&t===Q}function Ga(e,t){Wn=cl=!0;var n=e.pending;n===null?t.next=t:(t.next=n.next,n.next=t),e.pending=t}function Ja(e,t,n){if(n&4194240){var r=t.lanes;r&=e.pendingLanes,n|=r,t.lanes=n,wo(e,n)}}var fl={readContext:ze,useCallback:ie,useContext:ie,useEffect:ie,useImperativeHandle:ie,useInsertionEffect:ie,useLayoutEffect:ie,useMemo:ie,useReducer:ie,useRef:ie,useState:ie,useDebugValue:ie,useDeferredValue:ie,useTransition:ie,useMutableSource:ie,useSyncExternalStore:ie,useId:ie,unstable_isNewReconciler:!1},Md={readContext:ze,useCallback:function(e,t){return Qe().memoizedState=[e,t===void 0?null:t],e},useContext:ze,useEffect:Hu,useImperativeHandle:function(e,t,n){return n=n!=null?n.concat([e]):null,Wr(4194308,4,Wa.bind(null,t,e),n)},useLayoutEffect:function(e,t){return Wr(4194308,4,e,t)},useInsertionEffect:function(e,t){return Wr(4,2,e,t)},useMemo:function(e,t){var n=Qe();return t=t===void 0?null:t,e=e(),n.memoizedState=[e,t],e},useReducer:function(e,t,n){var r=Qe();return t=n!==void 0?n(t):t,r.memoizedState=r.baseState=t,e={pending:null,interleaved:null,lanes:0,dispatch:null,lastRenderedReducer:e,lastRenderedState:t},r.queue=e,e=e.dispatch=Td.bind(null,Q,e),[r.memoizedState,e]},useRef:function(e){var t=Qe();return e={current:e},t.memoizedState=e},useState:Bu,useDebugValue:Wo,useDeferredValue:function(e){return Qe().memoizedState=e},useTransition:function(){var e=Bu(!1),t=e[0];return e=Pd.bind(null,e[1]),Qe().memoizedState=e,[t,e]},useMutableSource:function(){},useSyncExternalStore:function(e,t,n){var r=Q,l=Qe();if(W){if(n===void 0)throw Error(g(407));n=n()}else{if(n=t(),ee===null)throw Error(g(349));At&30||Da(r,t,n)}l.memoizedState=n;var i={value:n,getSnapshot:t};return l.queue=i,Hu(Oa.bind(null,r,i,e),[e]),r.flags|=2048,sr(9,Ia.bind(null,r,i,n,t),void 0,null),n},useId:function(){var e=Qe(),t=ee.identifierPrefix;if(W){var n=be,r=qe;n=(r&~(1<<32-Ae(r)-1)).toString(32)+n,t=":"+t+"R"+n,n=or++,0<n&&(t+="H"+n.toString(32)),t+=":"}else n=Ld++,t=":"+t+"r"+n.toString(32)+":";return e.memoizedState=t},unstable_isNewReconciler:!1},jd={readContext:ze,useCallback:Ha,useContext:ze,useEffect:$o,useImperativeHandle:Ba,useInsertionEffect:Aa,useLayoutEffect:$a,useMemo:Qa,useReducer:li,useRef:Va,useState:function(){return li(ur)},useDebugValue:Wo,useDeferredValue:function(e){var t=Me();return Ya(t,Z.memoizedState,e)},useTransition:function(){var e=li(ur)[0],t=Me().memoizedState;return[e,t]},useMutableSource:ja,useSyncExternalStore:Ra,useId:Ka,unstable_isNewReconciler:!1},Rd={readContext:ze,useCallback:Ha,useContext:ze,useEffect:$o,useImperativeHandle:Ba,useInsertionEffect:Aa,useLayoutEffect:$a,useMemo:Qa,useReducer:ii,useRef:Va,useState:function(){return ii(ur)},useDebugValue:Wo,useDeferredValue:function(e){var t=Me();return Z===null?t.memoizedState=e:Ya(t,Z.memoizedState,e)},useTransition:function(){var e=ii(ur)[0],t=Me().memoizedState;return[e,t]},useMutableSource:ja,useSyncExternalStore:Ra,useId:Ka,unstable_isNewReconciler:!1};function Oe(e,t){if(e&&e.defaultProps){t=Y({},t),e=e.defaultProps;for(var n in e)t[n]===void 0&&(t[n]=e[n]);return t}return t}function Bi(e,t,n,r){t=e.memoizedState,n=n(r,t),n=n==null?t:Y({},t,n),e.memoizedState=n,e.lanes===0&&(e.updateQueue.baseState=n)}var Nl={isMounted:function(e){return(e=e._reactInternals)?Ht(e)===e:!1},enqueueSetState:function(e,t,n){e=e._reactInternals;var r=ce(),l=kt(e),i=et(r,l);i.payload=t,n!=null&&(i.callback=n),t=wt(e,i,l),t!==null&&($e(t,e,l,r),Ar(t,e,l))},enqueueReplaceState:function(e,t,n){e=e._reactInternals;var r=ce(),l=kt(e),i=et(r,l);i.tag=1,i.payload=t,n!=null&&(i.callback=n),t=wt(e,i,l),t!==null&&($e(t,e,l,r),Ar(t,e,l))},enqueueForceUpdate:function(e,t){e=e._reactInternals;var n=ce(),r=kt(e),l=et(n,r);l.tag=2,t!=null&&(l.callback=t),t=wt(e,l,r),t!==null&&($e(t,e,r,n),Ar(t,e,r))}};function Qu(e,t,n,r,l,i,o){return e=e.stateNode,typeof e.shouldComponentUpdate=="function"?e.shouldComponentUpdate(r,i,o):t.prototype&&t.prototype.isPureReactComponent?!er(n,r)||!er(l,i):!0}function Za(e,t,n){var r=!1,l=Ct,i=t.contextType;return typeof i=="object"&&i!==null?i=ze(i):(l=ge(t)?Ut:se.current,r=t.contextTypes,i=(r=r!=null)?vn(e,l):Ct),t=new t(n,i),e.memoizedState=t.state!==null&&t.state!==void 0?t.state:null,t.updater=Nl,e.stateNode=t,t._reactInternals=e,r&&(e=e.stateNode,e.__reactInternalMemoizedUnmaskedChildContext=l,e.__reactInternalMemoizedMaskedChildContext=i),t}function Yu(e,t,n,r){e=t.state,typeof t.componentWillReceiveProps=="function"&&t.componentWillReceiveProps(n,r),typeof t.UNSAFE_componentWillReceiveProps=="function"&&t.UNSAFE_componentWillReceiveProps(n,r),t.state!==e&&Nl.enqueueReplaceState(t,t.state,null)}function Hi(e,t,n,r){var l=e.stateNode;l.props=n,l.state=e.memoizedState,l.refs={},Do(e);var i=t.contextType;typeof i=="object"&&i!==null?l.context=ze(i):(i=ge(t)?Ut:se.current,l.context=vn(e,i)),l.state=e.memoizedState,i=t.getDerivedStateFromProps,typeof i=="function"&&(Bi(e,t,i,n),l.state=e.memoizedState),typeof t.getDerivedStateFromProps=="function"||typeof l.getSnapshotBeforeUpdate=="function"||typeof l.UNSAFE_componentWillMount!="function"&&typeof l.componentWillMount!="function"||(t=l.state,typeof l.componentWillMount=="function"&&l.componentWillMount(),typeof l.UNSAFE_componentWillMount=="function"&&l.UNSAFE_componentWillMount(),t!==l.state&&Nl.enqueueReplaceState(l,l.state,null),sl(e,n,l,r),l.state=e.memoizedState),typeof l.componentDidMount=="function"&&(e.flags|=4194308)}function yn(e,t){try{var n="",r=t;do n+=uf(r),r=r.return;while(r);var l=n}catch(i){l=`
-Error generating stack: `+i.message+`
-`+i.stack}return{value:e,source:t,stack:l,digest:null}}function oi(e,t,n){return{value:e,source:null,stack:n??null,digest:t??null}}function Qi(e,t){try{console.error(t.value)}catch(n){setTimeout(function(){throw n})}}var Dd=typeof WeakMap=="function"?WeakMap:Map;function qa(e,t,n){n=et(-1,n),n.tag=3,n.payload={element:null};var r=t.value;return n.callback=function(){pl||(pl=!0,to=r),Qi(e,t)},n}function ba(e,t,n){n=et(-1,n),n.tag=3;var r=e.type.getDerivedStateFromError;if(typeof r=="function"){var l=t.value;n.payload=function(){return r(l)},n.callback=function(){Qi(e,t)}}var i=e.stateNode;return i!==null&&typeof i.componentDidCatch=="function"&&(n.callback=function(){Qi(e,t),typeof r!="function"&&(St===null?St=new Set([this]):St.add(this));var o=t.stack;this.componentDidCatch(t.value,{componentStack:o!==null?o:""})}),n}function Ku(e,t,n){var r=e.pingCache;if(r===null){r=e.pingCache=new Dd;var l=new Set;r.set(t,l)}else l=r.get(t),l===void 0&&(l=new Set,r.set(t,l));l.has(n)||(l.add(n),e=Xd.bind(null,e,t,n),t.then(e,e))}function Xu(e){do{var t;if((t=e.tag===13)&&(t=e.memoizedState,t=t!==null?t.dehydrated!==null:!0),t)return e;e=e.return}while(e!==null);return null}function Gu(e,t,n,r,l){return e.mode&1?(e.flags|=65536,e.lanes=l,e):(e===t?e.flags|=65536:(e.flags|=128,n.flags|=131072,n.flags&=-52805,n.tag===1&&(n.alternate===null?n.tag=17:(t=et(-1,1),t.tag=2,wt(n,t,1))),n.lanes|=1),e)}var Id=it.ReactCurrentOwner,he=!1;function ae(e,t,n,r){t.child=e===null?Pa(t,null,n,r):mn(t,e.child,n,r)}function Ju(e,t,n,r,l){n=n.render;var i=t.ref;return fn(t,l),r=Vo(e,t,n,r,i,l),n=Ao(),e!==null&&!he?(t.updateQueue=e.updateQueue,t.flags&=-2053,e.lanes&=~l,lt(e,t,l)):(W&&n&&Lo(t),t.flags|=1,ae(e,t,r,l),t.child)}function Zu(e,t,n,r,l){if(e===null){var i=n.type;return typeof i=="function"&&!Jo(i)&&i.defaultProps===void 0&&n.compare===null&&n.defaultProps===void 0?(t.tag=15,t.type=i,ec(e,t,i,r,l)):(e=Yr(n.type,null,r,t,t.mode,l),e.ref=t.ref,e.return=t,t.child=e)}if(i=e.child,!(e.lanes&l)){var o=i.memoizedProps;if(n=n.compare,n=n!==null?n:er,n(o,r)&&e.ref===t.ref)return lt(e,t,l)}return t.flags|=1,e=Et(i,r),e.ref=t.ref,e.return=t,t.child=e}function ec(e,t,n,r,l){if(e!==null){var i=e.memoizedProps;if(er(i,r)&&e.ref===t.ref)if(he=!1,t.pendingProps=r=i,(e.lanes&l)!==0)e.flags&131072&&(he=!0);else return t.lanes=e.lanes,lt(e,t,l)}return Yi(e,t,n,r,l)}function tc(e,t,n){var r=t.pendingProps,l=r.children,i=e!==null?e.memoizedState:null;if(r.mode==="hidden")if(!(t.mode&1))t.memoizedState={baseLanes:0,cachePool:null,transitions:null},V(on,Se),Se|=n;else{if(!(n&1073741824))return e=i!==null?i.baseLanes|n:n,t.lanes=t.childLanes=1073741824,t.memoizedState={baseLanes:e,cachePool:null,transitions:null},t.updateQueue=null,V(on,Se),Se|=e,null;t.memoizedState={baseLanes:0,cachePool:null,transitions:null},r=i!==null?i.baseLanes:n,V(on,Se),Se|=r}else i!==null?(r=i.baseLanes|n,t.memoizedState=null):r=n,V(on,Se),Se|=r;return ae(e,t,l,n),t.child}function nc(e,t){var n=t.ref;(e===null&&n!==null||e!==null&&e.ref!==n)&&(t.flags|=512,t.flags|=2097152)}function Yi(e,t,n,r,l){var i=ge(n)?Ut:se.current;return i=vn(t,i),fn(t,l),n=Vo(e,t,n,r,i,l),r=Ao(),e!==null&&!he?(t.updateQueue=e.updateQueue,t.flags&=-2053,e.lanes&=~l,lt(e,t,l)):(W&&r&&Lo(t),t.flags|=1,ae(e,t,n,l),t.child)}function qu(e,t,n,r,l){if(ge(n)){var i=!0;rl(t)}else i=!1;if(fn(t,l),t.stateNode===null)Br(e,t),Za(t,n,r),Hi(t,n,r,l),r=!0;else if(e===null){var o=t.stateNode,u=t.memoizedProps;o.props=u;var s=o.context,f=n.contextType;typeof f=="object"&&f!==null?f=ze(f):(f=ge(n)?Ut:se.current,f=vn(t,f));var m=n.getDerivedStateFromProps,h=typeof m=="function"||typeof o.getSnapshotBeforeUpdate=="function";h||typeof o.UNSAFE_componentWillReceiveProps!="function"&&typeof o.componentWillReceiveProps!="function"||(u!==r||s!==f)&&Yu(t,o,r,f),ct=!1;var v=t.memoizedState;o.state=v,sl(t,r,o,l),s=t.memoizedState,u!==r||v!==s||me.current||ct?(typeof m=="function"&&(Bi(t,n,m,r),s=t.memoizedState),(u=ct||Qu(t,n,u,r,v,s,f))?(h||typeof o.UNSAFE_componentWillMount!="function"&&typeof o.componentWillMount!="function"||(typeof o.componentWillMount=="function"&&o.componentWillMount(),typeof o.UNSAFE_componentWillMount=="function"&&o.UNSAFE_componentWillMount()),typeof o.componentDidMount=="function"&&(t.flags|=4194308)):(typeof o.componentDidMount=="function"&&(t.flags|=4194308),t.memoizedProps=r,t.memoizedState=s),o.props=r,o.state=s,o.context=f,r=u):(typeof o.componentDidMount=="function"&&(t.flags|=4194308),r=!1)}else{o=t.stateNode,za(e,t),u=t.memoizedProps,f=t.type===t.elementType?u:Oe(t.type,u),o.props=f,h=t.pendingProps,v=o.context,s=n.contextType,typeof s=="object"&&s!==null?s=ze(s):(s=ge(n)?Ut:se.current,s=vn(t,s));var S=n.getDerivedStateFromProps;(m=typeof S=="function"||typeof o.getSnapshotBeforeUpdate=="function")||typeof o.UNSAFE_componentWillReceiveProps!="function"&&typeof o.componentWillReceiveProps!="function"||(u!==h||v!==s)&&Yu(t,o,r,s),ct=!1,v=t.memoizedState,o.state=v,sl(t,r,o,l);var y=t.memoizedState;u!==h||v!==y||me.current||ct?(typeof S=="function"&&(Bi(t,n,S,r),y=t.memoizedState),(f=ct||Qu(t,n,f,r,v,y,s)||!1)?(m||typeof o.UNSAFE_componentWillUpdate!="function"&&typeof o.componentWillUpdate!="function"||(typeof o.componentWillUpdate=="function"&&o.componentWillUpdate(r,y,s),typeof o.UNSAFE_componentWillUpdate=="function"&&o.UNSAFE_componentWillUpdate(r,y,s)),typeof o.componentDidUpdate=="function"&&(t.flags|=4),typeof o.getSnapshotBeforeUpdate=="function"&&(t.flags|=1024)):(typeof o.componentDidUpdate!="function"||u===e.memoizedProps&&v===e.memoizedState||(t.flags|=4),typeof o.getSnapshotBeforeUpdate!="function"||u===e.memoizedProps&&v===e.memoizedState||(t.flags|=1024),t.memoizedProps=r,t.memoizedState=y),o.props=r,o.state=y,o.context=s,r=f):(typeof o.componentDidUpdate!="function"||u===e.memoizedProps&&v===e.memoizedState||(t.flags|=4),typeof o.getSnapshotBeforeUpdate!="function"||u===e.memoizedProps&&v===e.memoizedState||(t.flags|=1024),r=!1)}return Ki(e,t,n,r,i,l)}function Ki(e,t,n,r,l,i){nc(e,t);var o=(t.flags&128)!==0;if(!r&&!o)return l&&Fu(t,n,!1),lt(e,t,i);r=t.stateNode,Id.current=t;var u=o&&typeof n.getDerivedStateFromError!="function"?null:r.render();return t.flags|=1,e!==null&&o?(t.child=mn(t,e.child,null,i),t.child=mn(t,null,u,i)):ae(e,t,u,i),t.memoizedState=r.state,l&&Fu(t,n,!0),t.child}function rc(e){var t=e.stateNode;t.pendingContext?Ou(e,t.pendingContext,t.pendingContext!==t.context):t.context&&Ou(e,t.context,!1),Io(e,t.containerInfo)}function bu(e,t,n,r,l){return hn(),To(l),t.flags|=256,ae(e,t,n,r),t.child}var Xi={dehydrated:null,treeContext:null,retryLane:0};function Gi(e){return{baseLanes:e,cachePool:null,transitions:null}}function lc(e,t,n){var r=t.pendingProps,l=H.current,i=!1,o=(t.flags&128)!==0,u;if((u=o)||(u=e!==null&&e.memoizedState===null?!1:(l&2)!==0),u?(i=!0,t.flags&=-129):(e===null||e.memoizedState!==null)&&(l|=1),V(H,l&1),e===null)return $i(t),e=t.memoizedState,e!==null&&(e=e.dehydrated,e!==null)?(t.mode&1?e.data==="$!"?t.lanes=8:t.lanes=1073741824:t.lanes=1,null):(o=r.children,e=r.fallback,i?(r=t.mode,i=t.child,o={mode:"hidden",children:o},!(r&1)&&i!==null?(i.childLanes=0,i.pendingProps=o):i=Tl(o,r,0,null),e=Ft(e,r,n,null),i.return=t,e.return=t,i.sibling=e,t.child=i,t.child.memoizedState=Gi(n),t.memoizedState=Xi,e):Bo(t,o));if(l=e.memoizedState,l!==null&&(u=l.dehydrated,u!==null))return Od(e,t,o,r,u,l,n);if(i){i=r.fallback,o=t.mode,l=e.child,u=l.sibling;var s={mode:"hidden",children:r.children};return!(o&1)&&t.child!==l?(r=t.child,r.childLanes=0,r.pendingProps=s,t.deletions=null):(r=Et(l,s),r.subtreeFlags=l.subtreeFlags&14680064),u!==null?i=Et(u,i):(i=Ft(i,o,n,null),i.flags|=2),i.return=t,r.return=t,r.sibling=i,t.child=r,r=i,i=t.child,o=e.child.memoizedState,o=o===null?Gi(n):{baseLanes:o.baseLanes|n,cachePool:null,transitions:o.transitions},i.memoizedState=o,i.childLanes=e.childLanes&~n,t.memoizedState=Xi,r}return i=e.child,e=i.sibling,r=Et(i,{mode:"visible",children:r.children}),!(t.mode&1)&&(r.lanes=n),r.return=t,r.sibling=null,e!==null&&(n=t.deletions,n===null?(t.deletions=[e],t.flags|=16):n.push(e)),t.child=r,t.memoizedState=null,r}function Bo(e,t){return t=Tl({mode:"visible",children:t},e.mode,0,null),t.return=e,e.child=t}function Mr(e,t,n,r){return r!==null&&To(r),mn(t,e.child,null,n),e=Bo(t,t.pendingProps.children),e.flags|=2,t.memoizedState=null,e}function Od(e,t,n,r,l,i,o){if(n)return t.flags&256?(t.flags&=-257,r=oi(Error(g(422))),Mr(e,t,o,r)):t.memoizedState!==null?(t.child=e.child,t.flags|=128,null):(i=r.fallback,l=t.mode,r=Tl({mode:"visible",children:r.children},l,0,null),i=Ft(i,l,o,null),i.flags|=2,r.return=t,i.return=t,r.sibling=i,t.child=r,t.mode&1&&mn(t,e.child,null,o),t.child.memoizedState=Gi(o),t.memoizedState=Xi,i);if(!(t.mode&1))return Mr(e,t,o,null);if(l.data==="$!"){if(r=l.nextSibling&&l.nextSibling.dataset,r)var u=r.dgst;return r=u,i=Error(g(419)),r=oi(i,r,void 0),Mr(e,t,o,r)}if(u=(o&e.childLanes)!==0,he||u){if(r=ee,r!==null){switch(o&-o){case 4:l=2;break;case 16:l=8;break;case 64:case 128:case 256:case 512:case 1024:case 2048:case 4096:case 8192:case 16384:case 32768:case 65536:case 131072:case 262144:case 524288:case 1048576:case 2097152:case 4194304:case 8388608:case 16777216:case 33554432:case 67108864:l=32;break;case 536870912:l=268435456;break;default:l=0}l=l&(r.suspendedLanes|o)?0:l,l!==0&&l!==i.retryLane&&(i.retryLane=l,rt(e,l),$e(r,e,l,-1))}return Go(),r=oi(Error(g(421))),Mr(e,t,o,r)}return l.data==="$?"?(t.flags|=128,t.child=e.child,t=Gd.bind(null,e),l._reactRetry=t,null):(e=i.treeContext,ke=yt(l.nextSibling),Ee=t,W=!0,Ue=null,e!==null&&(Ne[Le++]=qe,Ne[Le++]=be,Ne[Le++]=Vt,qe=e.id,be=e.overflow,Vt=t),t=Bo(t,r.children),t.flags|=4096,t)}function es(e,t,n){e.lanes|=t;var r=e.alternate;r!==null&&(r.lanes|=t),Wi(e.return,t,n)}function ui(e,t,n,r,l){var i=e.memoizedState;i===null?e.memoizedState={isBackwards:t,rendering:null,renderingStartTime:0,last:r,tail:n,tailMode:l}:(i.isBackwards=t,i.rendering=null,i.renderingStartTime=0,i.last=r,i.tail=n,i.tailMode=l)}function ic(e,t,n){var r=t.pendingProps,l=r.revealOrder,i=r.tail;if(ae(e,t,r.children,n),r=H.current,r&2)r=r&1|2,t.flags|=128;else{if(e!==null&&e.flags&128)e:for(e=t.child;e!==null;){if(e.tag===13)e.memoizedState!==null&&es(e,n,t);else if(e.tag===19)es(e,n,t);else if(e.child!==null){e.child.return=e,e=e.child;continue}if(e===t)break e;for(;e.sibling===null;){if(e.return===null||e.return===t)break e;e=e.return}e.sibling.return=e.return,e=e.sibling}r&=1}if(V(H,r),!(t.mode&1))t.memoizedState=null;else switch(l){case"forwards":for(n=t.child,l=null;n!==null;)e=n.alternate,e!==null&&al(e)===null&&(l=n),n=n.sibling;n=l,n===null?(l=t.child,t.child=null):(l=n.sibling,n.sibling=null),ui(t,!1,l,n,i);break;case"backwards":for(n=null,l=t.child,t.child=null;l!==null;){if(e=l.alternate,e!==null&&al(e)===null){t.child=l;break}e=l.sibling,l.sibling=n,n=l,l=e}ui(t,!0,n,null,i);break;case"together":ui(t,!1,null,null,void 0);break;default:t.memoizedState=null}return t.child}function Br(e,t){!(t.mode&1)&&e!==null&&(e.alternate=null,t.alternate=null,t.flags|=2)}function lt(e,t,n){if(e!==null&&(t.dependencies=e.dependencies),$t|=t.lanes,!(n&t.childLanes))return null;if(e!==null&&t.child!==e.child)throw Error(g(153));if(t.child!==null){for(e=t.child,n=Et(e,e.pendingProps),t.child=n,n.return=t;e.sibling!==null;)e=e.sibling,n=n.sibling=Et(e,e.pendingProps),n.return=t;n.sibling=null}return t.child}function Fd(e,t,n){switch(t.tag){case 3:rc(t),hn();break;case 5:Ma(t);break;case 1:ge(t.type)&&rl(t);break;case 4:Io(t,t.stateNode.containerInfo);break;case 10:var r=t.type._context,l=t.memoizedProps.value;V(ol,r._currentValue),r._currentValue=l;break;case 13:if(r=t.memoizedState,r!==null)return r.dehydrated!==null?(V(H,H.current&1),t.flags|=128,null):n&t.child.childLanes?lc(e,t,n):(V(H,H.current&1),e=lt(e,t,n),e!==null?e.sibling:null);V(H,H.current&1);break;case 19:if(r=(n&t.childLanes)!==0,e.flags&128){if(r)return ic(e,t,n);t.flags|=128}if(l=t.memoizedState,l!==null&&(l.rendering=null,l.tail=null,l.lastEffect=null),V(H,H.current),r)break;return null;case 22:case 23:return t.lanes=0,tc(e,t,n)}return lt(e,t,n)}var oc,Ji,uc,sc;oc=function(e,t){for(var n=t.child;n!==null;){if(n.tag===5||n.tag===6)e.appendChild(n.stateNode);else if(n.tag!==4&&n.child!==null){n.child.return=n,n=n.child;continue}if(n===t)break;for(;n.sibling===null;){if(n.return===null||n.return===t)return;n=n.return}n.sibling.return=n.return,n=n.sibling}};Ji=function(){};uc=function(e,t,n,r){var l=e.memoizedProps;if(l!==r){e=t.stateNode,It(Xe.current);var i=null;switch(n){case"input":l=yi(e,l),r=yi(e,r),i=[];break;case"select":l=Y({},l,{value:void 0}),r=Y({},r,{value:void 0}),i=[];break;case"textarea":l=ki(e,l),r=ki(e,r),i=[];break;default:typeof l.onClick!="function"&&typeof r.onClick=="function"&&(e.onclick=tl)}xi(n,r);var o;n=null;for(f in l)if(!r.hasOwnProperty(f)&&l.hasOwnProperty(f)&&l[f]!=null)if(f==="style"){var u=l[f];for(o in u)u.hasOwnProperty(o)&&(n||(n={}),n[o]="")}else f!=="dangerouslySetInnerHTML"&&f!=="children"&&f!=="suppressContentEditableWarning"&&f!=="suppressHydrationWarning"&&f!=="autoFocus"&&(Kn.hasOwnProperty(f)?i||(i=[]):(i=i||[]).push(f,null));for(f in r){var s=r[f];if(u=l!=null?l[f]:void 0,r.hasOwnProperty(f)&&s!==u&&(s!=null||u!=null))if(f==="style")if(u){for(o in u)!u.hasOwnProperty(o)||s&&s.hasOwnProperty(o)||(n||(n={}),n[o]="");for(o in s)s.hasOwnProperty(o)&&u[o]!==s[o]&&(n||(n={}),n[o]=s[o])}else n||(i||(i=[]),i.push(f,n)),n=s;else f==="dangerouslySetInnerHTML"?(s=s?s.__html:void 0,u=u?u.__html:void 0,s!=null&&u!==s&&(i=i||[]).push(f,s)):f==="children"?typeof s!="string"&&typeof s!="number"||(i=i||[]).push(f,""+s):f!=="suppressContentEditableWarning"&&f!=="suppressHydrationWarning"&&(Kn.hasOwnProperty(f)?(s!=null&&f==="onScroll"&&A("scroll",e),i||u===s||(i=[])):(i=i||[]).push(f,s))}n&&(i=i||[]).push("style",n);var f=i;(t.updateQueue=f)&&(t.flags|=4)}};sc=function(e,t,n,r){n!==r&&(t.flags|=4)};function Mn(e,t){if(!W)switch(e.tailMode){case"hidden":t=e.tail;for(var n=null;t!==null;)t.alternate!==null&&(n=t),t=t.sibling;n===null?e.tail=null:n.sibling=null;break;case"collapsed":n=e.tail;for(var r=null;n!==null;)n.alternate!==null&&(r=n),n=n.sibling;r===null?t||e.tail===null?e.tail=null:e.tail.sibling=null:r.sibling=null}}function oe(e){var t=e.alternate!==null&&e.alternate.child===e.child,n=0,r=0;if(t)for(var l=e.child;l!==null;)n|=l.lanes|l.childLanes,r|=l.subtreeFlags&14680064,r|=l.flags&14680064,l.return=e,l=l.sibling;else for(l=e.child;l!==null;)n|=l.lanes|l.childLanes,r|=l.subtreeFlags,r|=l.flags,l.return=e,l=l.sibling;return e.subtreeFlags|=r,e.childLanes=n,t}function Ud(e,t,n){var r=t.pendingProps;switch(Po(t),t.tag){case 2:case 16:case 15:case 0:case 11:case 7:case 8:case 12:case 9:case 14:return oe(t),null;case 1:return ge(t.type)&&nl(),oe(t),null;case 3:return r=t.stateNode,gn(),$(me),$(se),Fo(),r.pendingContext&&(r.context=r.pendingContext,r.pendingContext=null),(e===null||e.child===null)&&(Tr(t)?t.flags|=4:e===null||e.memoizedState.isDehydrated&&!(t.flags&256)||(t.flags|=1024,Ue!==null&&(lo(Ue),Ue=null))),Ji(e,t),oe(t),null;case 5:Oo(t);var l=It(ir.current);if(n=t.type,e!==null&&t.stateNode!=null)uc(e,t,n,r,l),e.ref!==t.ref&&(t.flags|=512,t.flags|=2097152);else{if(!r){if(t.stateNode===null)throw Error(g(166));return oe(t),null}if(e=It(Xe.current),Tr(t)){r=t.stateNode,n=t.type;var i=t.memoizedProps;switch(r[Ye]=t,r[rr]=i,e=(t.mode&1)!==0,n){case"dialog":A("cancel",r),A("close",r);break;case"iframe":case"object":case"embed":A("load",r);break;case"video":case"audio":for(l=0;l<On.length;l++)A(On[l],r);break;case"source":A("error",r);break;case"img":case"image":case"link":A("error",r),A("load",r);break;case"details":A("toggle",r);break;case"input":au(r,i),A("invalid",r);break;case"select":r._wrapperState={wasMultiple:!!i.multiple},A("invalid",r);break;case"textarea":fu(r,i),A("invalid",r)}xi(n,i),l=null;for(var o in i)if(i.hasOwnProperty(o)){var u=i[o];o==="children"?typeof u=="string"?r.textContent!==u&&(i.suppressHydrationWarning!==!0&&Pr(r.textContent,u,e),l=["children",u]):typeof u=="number"&&r.textContent!==""+u&&(i.suppressHydrationWarning!==!0&&Pr(r.textContent,u,e),l=["children",""+u]):Kn.hasOwnProperty(o)&&u!=null&&o==="onScroll"&&A("scroll",r)}switch(n){case"input":Sr(r),cu(r,i,!0);break;case"textarea":Sr(r),du(r);break;case"select":case"option":break;default:typeof i.onClick=="function"&&(r.onclick=tl)}r=l,t.updateQueue=r,r!==null&&(t.flags|=4)}else{o=l.nodeType===9?l:l.ownerDocument,e==="http://www.w3.org/1999/xhtml"&&(e=Os(n)),e==="http://www.w3.org/1999/xhtml"?n==="script"?(e=o.createElement("div"),e.innerHTML="<script><\/script>",e=e.removeChild(e.firstChild)):typeof r.is=="string"?e=o.createElement(n,{is:r.is}):(e=o.createElement(n),n==="select"&&(o=e,r.multiple?o.multiple=!0:r.size&&(o.size=r.size))):e=o.createElementNS(e,n),e[Ye]=t,e[rr]=r,oc(e,t,!1,!1),t.stateNode=e;e:{switch(o=Ci(n,r),n){case"dialog":A("cancel",e),A("close",e),l=r;break;case"iframe":case"object":case"embed":A("load",e),l=r;break;case"video":case"audio":for(l=0;l<On.length;l++)A(On[l],e);l=r;break;case"source":A("error",e),l=r;break;case"img":case"image":case"link":A("error",e),A("load",e),l=r;break;case"details":A("toggle",e),l=r;break;case"input":au(e,r),l=yi(e,r),A("invalid",e);break;case"option":l=r;break;case"select":e._wrapperState={wasMultiple:!!r.multiple},l=Y({},r,{value:void 0}),A("invalid",e);break;case"textarea":fu(e,r),l=ki(e,r),A("invalid",e);break;default:l=r}xi(n,l),u=l;for(i in u)if(u.hasOwnProperty(i)){var s=u[i];i==="style"?Vs(e,s):i==="dangerouslySetInnerHTML"?(s=s?s.__html:void 0,s!=null&&Fs(e,s)):i==="children"?typeof s=="string"?(n!=="textarea"||s!=="")&&Xn(e,s):typeof s=="number"&&Xn(e,""+s):i!=="suppressContentEditableWarning"&&i!=="suppressHydrationWarning"&&i!=="autoFocus"&&(Kn.hasOwnProperty(i)?s!=null&&i==="onScroll"&&A("scroll",e):s!=null&&po(e,i,s,o))}switch(n){case"input":Sr(e),cu(e,r,!1);break;case"textarea":Sr(e),du(e);break;case"option":r.value!=null&&e.setAttribute("value",""+xt(r.value));break;case"select":e.multiple=!!r.multiple,i=r.value,i!=null?un(e,!!r.multiple,i,!1):r.defaultValue!=null&&un(e,!!r.multiple,r.defaultValue,!0);break;default:typeof l.onClick=="function"&&(e.onclick=tl)}switch(n){case"button":case"input":case"select":case"textarea":r=!!r.autoFocus;break e;case"img":r=!0;break e;default:r=!1}}r&&(t.flags|=4)}t.ref!==null&&(t.flags|=512,t.flags|=2097152)}return oe(t),null;case 6:if(e&&t.stateNode!=null)sc(e,t,e.memoizedProps,r);else{if(typeof r!="string"&&t.stateNode===null)throw Error(g(166));if(n=It(ir.current),It(Xe.current),Tr(t)){if(r=t.stateNode,n=t.memoizedProps,r[Ye]=t,(i=r.nodeValue!==n)&&(e=Ee,e!==null))switch(e.tag){case 3:Pr(r.nodeValue,n,(e.mode&1)!==0);break;case 5:e.memoizedProps.suppressHydrationWarning!==!0&&Pr(r.nodeValue,n,(e.mode&1)!==0)}i&&(t.flags|=4)}else r=(n.nodeType===9?n:n.ownerDocument).createTextNode(r),r[Ye]=t,t.stateNode=r}return oe(t),null;case 13:if($(H),r=t.memoizedState,e===null||e.memoizedState!==null&&e.memoizedState.dehydrated!==null){if(W&&ke!==null&&t.mode&1&&!(t.flags&128))Na(),hn(),t.flags|=98560,i=!1;else if(i=Tr(t),r!==null&&r.dehydrated!==null){if(e===null){if(!i)throw Error(g(318));if(i=t.memoizedState,i=i!==null?i.dehydrated:null,!i)throw Error(g(317));i[Ye]=t}else hn(),!(t.flags&128)&&(t.memoizedState=null),t.flags|=4;oe(t),i=!1}else Ue!==null&&(lo(Ue),Ue=null),i=!0;if(!i)return t.flags&65536?t:null}return t.flags&128?(t.lanes=n,t):(r=r!==null,r!==(e!==null&&e.memoizedState!==null)&&r&&(t.child.flags|=8192,t.mode&1&&(e===null||H.current&1?q===0&&(q=3):Go())),t.updateQueue!==null&&(t.flags|=4),oe(t),null);case 4:return gn(),Ji(e,t),e===null&&tr(t.stateNode.containerInfo),oe(t),null;case 10:return jo(t.type._context),oe(t),null;case 17:return ge(t.type)&&nl(),oe(t),null;case 19:if($(H),i=t.memoizedState,i===null)return oe(t),null;if(r=(t.flags&128)!==0,o=i.rendering,o===null)if(r)Mn(i,!1);else{if(q!==0||e!==null&&e.flags&128)for(e=t.child;e!==null;){if(o=al(e),o!==null){for(t.flags|=128,Mn(i,!1),r=o.updateQueue,r!==null&&(t.updateQueue=r,t.flags|=4),t.subtreeFlags=0,r=n,n=t.child;n!==null;)i=n,e=r,i.flags&=14680066,o=i.alternate,o===null?(i.childLanes=0,i.lanes=e,i.child=null,i.subtreeFlags=0,i.memoizedProps=null,i.memoizedState=null,i.updateQueue=null,i.dependencies=null,i.stateNode=null):(i.childLanes=o.childLanes,i.lanes=o.lanes,i.child=o.child,i.subtreeFlags=0,i.deletions=null,i.memoizedProps=o.memoizedProps,i.memoizedState=o.memoizedState,i.updateQueue=o.updateQueue,i.type=o.type,e=o.dependencies,i.dependencies=e===null?null:{lanes:e.lanes,firstContext:e.firstContext}),n=n.sibling;return V(H,H.current&1|2),t.child}e=e.sibling}i.tail!==null&&G()>wn&&(t.flags|=128,r=!0,Mn(i,!1),t.lanes=4194304)}else{if(!r)if(e=al(o),e!==null){if(t.flags|=128,r=!0,n=e.updateQueue,n!==null&&(t.updateQueue=n,t.flags|=4),Mn(i,!0),i.tail===null&&i.tailMode==="hidden"&&!o.alternate&&!W)return oe(t),null}else 2*G()-i.renderingStartTime>wn&&n!==1073741824&&(t.flags|=128,r=!0,Mn(i,!1),t.lanes=4194304);i.isBackwards?(o.sibling=t.child,t.child=o):(n=i.last,n!==null?n.sibling=o:t.child=o,i.last=o)}return i.tail!==null?(t=i.tail,i.rendering=t,i.tail=t.sibling,i.renderingStartTime=G(),t.sibling=null,n=H.current,V(H,r?n&1|2:n&1),t):(oe(t),null);case 22:case 23:return Xo(),r=t.memoizedState!==null,e!==null&&e.memoizedState!==null!==r&&(t.flags|=8192),r&&t.mode&1?Se&1073741824&&(oe(t),t.subtreeFlags&6&&(t.flags|=8192)):oe(t),null;case 24:return null;case 25:return null}throw Error(g(156,t.tag))}function Vd(e,t){switch(Po(t),t.tag){case 1:return ge(t.type)&&nl(),e=t.flags,e&65536?(t.flags=e&-65537|128,t):null;case 3:return gn(),$(me),$(se),Fo(),e=t.flags,e&65536&&!(e&128)?(t.flags=e&-65537|128,t):null;case 5:return Oo(t),null;case 13:if($(H),e=t.memoizedState,e!==null&&e.dehydrated!==null){if(t.alternate===null)throw Error(g(340));hn()}return e=t.flags,e&65536?(t.flags=e&-65537|128,t):null;case 19:return $(H),null;case 4:return gn(),null;case 10:return jo(t.type._context),null;case 22:case 23:return Xo(),null;case 24:return null;default:return null}}var jr=!1,ue=!1,Ad=typeof WeakSet=="function"?WeakSet:Set,L=null;function ln(e,t){var n=e.ref;if(n!==null)if(typeof n=="function")try{n(null)}catch(r){K(e,t,r)}else n.current=null}function Zi(e,t,n){try{n()}catch(r){K(e,t,r)}}var ts=!1;function $d(e,t){if(Di=qr,e=pa(),No(e)){if("selectionStart"in e)var n={start:e.selectionStart,end:e.selectionEnd};else e:{n=(n=e.ownerDocument)&&n.defaultView||window;var r=n.getSelection&&n.getSelection();if(r&&r.rangeCount!==0){n=r.anchorNode;var l=r.anchorOffset,i=r.focusNode;r=r.focusOffset;try{n.nodeType,i.nodeType}catch{n=null;break e}var o=0,u=-1,s=-1,f=0,m=0,h=e,v=null;t:for(;;){for(var S;h!==n||l!==0&&h.nodeType!==3||(u=o+l),h!==i||r!==0&&h.nodeType!==3||(s=o+r),h.nodeType===3&&(o+=h.nodeValue.length),(S=h.firstChild)!==null;)v=h,h=S;for(;;){if(h===e)break t;if(v===n&&++f===l&&(u=o),v===i&&++m===r&&(s=o),(S=h.nextSibling)!==null)break;h=v,v=h.parentNode}h=S}n=u===-1||s===-1?null:{start:u,end:s}}else n=null}n=n||{start:0,end:0}}else n=null;for(Ii={focusedElem:e,selectionRange:n},qr=!1,L=t;L!==null;)if(t=L,e=t.child,(t.subtreeFlags&1028)!==0&&e!==null)e.return=t,L=e;else for(;L!==null;){t=L;try{var y=t.alternate;if(t.flags&1024)switch(t.tag){case 0:case 11:case 15:break;case 1:if(y!==null){var k=y.memoizedProps,D=y.memoizedState,d=t.stateNode,a=d.getSnapshotBeforeUpdate(t.elementType===t.type?k:Oe(t.type,k),D);d.__reactInternalSnapshotBeforeUpdate=a}break;case 3:var c=t.stateNode.containerInfo;c.nodeType===1?c.textContent="":c.nodeType===9&&c.documentElement&&c.removeChild(c.documentElement);break;case 5:case 6:case 4:case 17:break;default:throw Error(g(163))}}catch(p){K(t,t.return,p)}if(e=t.sibling,e!==null){e.return=t.return,L=e;break}L=t.return}return y=ts,ts=!1,y}function Bn(e,t,n){var r=t.updateQueue;if(r=r!==null?r.lastEffect:null,r!==null){var l=r=r.next;do{if((l.tag&e)===e){var i=l.destroy;l.destroy=void 0,i!==void 0&&Zi(t,n,i)}l=l.next}while(l!==r)}}function Ll(e,t){if(t=t.updateQueue,t=t!==null?t.lastEffect:null,t!==null){var n=t=t.next;do{if((n.tag&e)===e){var r=n.create;n.destroy=r()}n=n.next}while(n!==t)}}function qi(e){var t=e.ref;if(t!==null){var n=e.stateNode;switch(e.tag){case 5:e=n;break;default:e=n}typeof t=="function"?t(e):t.current=e}}function ac(e){var t=e.alternate;t!==null&&(e.alternate=null,ac(t)),e.child=null,e.deletions=null,e.sibling=null,e.tag===5&&(t=e.stateNode,t!==null&&(delete t[Ye],delete t[rr],delete t[Ui],delete t[xd],delete t[Cd])),e.stateNode=null,e.return=null,e.dependencies=null,e.memoizedProps=null,e.memoizedState=null,e.pendingProps=null,e.stateNode=null,e.updateQueue=null}function cc(e){return e.tag===5||e.tag===3||e.tag===4}function ns(e){e:for(;;){for(;e.sibling===null;){if(e.return===null||cc(e.return))return null;e=e.return}for(e.sibling.return=e.return,e=e.sibling;e.tag!==5&&e.tag!==6&&e.tag!==18;){if(e.flags&2||e.child===null||e.tag===4)continue e;e.child.return=e,e=e.child}if(!(e.flags&2))return e.stateNode}}function bi(e,t,n){var r=e.tag;if(r===5||r===6)e=e.stateNode,t?n.nodeType===8?n.parentNode.insertBefore(e,t):n.insertBefore(e,t):(n.nodeType===8?(t=n.parentNode,t.insertBefore(e,n)):(t=n,t.appendChild(e)),n=n._reactRootContainer,n!=null||t.onclick!==null||(t.onclick=tl));else if(r!==4&&(e=e.child,e!==null))for(bi(e,t,n),e=e.sibling;e!==null;)bi(e,t,n),e=e.sibling}function eo(e,t,n){var r=e.tag;if(r===5||r===6)e=e.stateNode,t?n.insertBefore(e,t):n.appendChild(e);else if(r!==4&&(e=e.child,e!==null))for(eo(e,t,n),e=e.sibling;e!==null;)eo(e,t,n),e=e.sibling}var te=null,Fe=!1;function ut(e,t,n){for(n=n.child;n!==null;)fc(e,t,n),n=n.sibling}function fc(e,t,n){if(Ke&&typeof Ke.onCommitFiberUnmount=="function")try{Ke.onCommitFiberUnmount(wl,n)}catch{}switch(n.tag){case 5:ue||ln(n,t);case 6:var r=te,l=Fe;te=null,ut(e,t,n),te=r,Fe=l,te!==null&&(Fe?(e=te,n=n.stateNode,e.nodeType===8?e.parentNode.removeChild(n):e.removeChild(n)):te.removeChild(n.stateNode));break;case 18:te!==null&&(Fe?(e=te,n=n.stateNode,e.nodeType===8?ei(e.parentNode,n):e.nodeType===1&&ei(e,n),qn(e)):ei(te,n.stateNode));break;case 4:r=te,l=Fe,te=n.stateNode.containerInfo,Fe=!0,ut(e,t,n),te=r,Fe=l;break;case 0:case 11:case 14:case 15:if(!ue&&(r=n.updateQueue,r!==null&&(r=r.lastEffect,r!==null))){l=r=r.next;do{var i=l,o=i.destroy;i=i.tag,o!==void 0&&(i&2||i&4)&&Zi(n,t,o),l=l.next}while(l!==r)}ut(e,t,n);break;case 1:if(!ue&&(ln(n,t),r=n.stateNode,typeof r.componentWillUnmount=="function"))try{r.props=n.memoizedProps,r.state=n.memoizedState,r.componentWillUnmount()}catch(u){K(n,t,u)}ut(e,t,n);break;case 21:ut(e,t,n);break;case 22:n.mode&1?(ue=(r=ue)||n.memoizedState!==null,ut(e,t,n),ue=r):ut(e,t,n);break;default:ut(e,t,n)}}function rs(e){var t=e.updateQueue;if(t!==null){e.updateQueue=null;var n=e.stateNode;n===null&&(n=e.stateNode=new Ad),t.forEach(function(r){var l=Jd.bind(null,e,r);n.has(r)||(n.add(r),r.then(l,l))})}}function Ie(e,t){var n=t.deletions;if(n!==null)for(var r=0;r<n.length;r++){var l=n[r];try{var i=e,o=t,u=o;e:for(;u!==null;){switch(u.tag){case 5:te=u.stateNode,Fe=!1;break e;case 3:te=u.stateNode.containerInfo,Fe=!0;break e;case 4:te=u.stateNode.containerInfo,Fe=!0;break e}u=u.return}if(te===null)throw Error(g(160));fc(i,o,l),te=null,Fe=!1;var s=l.alternate;s!==null&&(s.return=null),l.return=null}catch(f){K(l,t,f)}}if(t.subtreeFlags&12854)for(t=t.child;t!==null;)dc(t,e),t=t.sibling}function dc(e,t){var n=e.alternate,r=e.flags;switch(e.tag){case 0:case 11:case 14:case 15:if(Ie(t,e),He(e),r&4){try{Bn(3,e,e.return),Ll(3,e)}catch(k){K(e,e.return,k)}try{Bn(5,e,e.return)}catch(k){K(e,e.return,k)}}break;case 1:Ie(t,e),He(e),r&512&&n!==null&&ln(n,n.return);break;case 5:if(Ie(t,e),He(e),r&512&&n!==null&&ln(n,n.return),e.flags&32){var l=e.stateNode;try{Xn(l,"")}catch(k){K(e,e.return,k)}}if(r&4&&(l=e.stateNode,l!=null)){var i=e.memoizedProps,o=n!==null?n.memoizedProps:i,u=e.type,s=e.updateQueue;if(e.updateQueue=null,s!==null)try{u==="input"&&i.type==="radio"&&i.name!=null&&Ds(l,i),Ci(u,o);var f=Ci(u,i);for(o=0;o<s.length;o+=2){var m=s[o],h=s[o+1];m==="style"?Vs(l,h):m==="dangerouslySetInnerHTML"?Fs(l,h):m==="children"?Xn(l,h):po(l,m,h,f)}switch(u){case"input":wi(l,i);break;case"textarea":Is(l,i);break;case"select":var v=l._wrapperState.wasMultiple;l._wrapperState.wasMultiple=!!i.multiple;var S=i.value;S!=null?un(l,!!i.multiple,S,!1):v!==!!i.multiple&&(i.defaultValue!=null?un(l,!!i.multiple,i.defaultValue,!0):un(l,!!i.multiple,i.multiple?[]:"",!1))}l[rr]=i}catch(k){K(e,e.return,k)}}break;case 6:if(Ie(t,e),He(e),r&4){if(e.stateNode===null)throw Error(g(162));l=e.stateNode,i=e.memoizedProps;try{l.nodeValue=i}catch(k){K(e,e.return,k)}}break;case 3:if(Ie(t,e),He(e),r&4&&n!==null&&n.memoizedState.isDehydrated)try{qn(t.containerInfo)}catch(k){K(e,e.return,k)}break;case 4:Ie(t,e),He(e);break;case 13:Ie(t,e),He(e),l=e.child,l.flags&8192&&(i=l.memoizedState!==null,l.stateNode.isHidden=i,!i||l.alternate!==null&&l.alternate.memoizedState!==null||(Yo=G())),r&4&&rs(e);break;case 22:if(m=n!==null&&n.memoizedState!==null,e.mode&1?(ue=(f=ue)||m,Ie(t,e),ue=f):Ie(t,e),He(e),r&8192){if(f=e.memoizedState!==null,(e.stateNode.isHidden=f)&&!m&&e.mode&1)for(L=e,m=e.child;m!==null;){for(h=L=m;L!==null;){switch(v=L,S=v.child,v.tag){case 0:case 11:case 14:case 15:Bn(4,v,v.return);break;case 1:ln(v,v.return);var y=v.stateNode;if(typeof y.componentWillUnmount=="function"){r=v,n=v.return;try{t=r,y.props=t.memoizedProps,y.state=t.memoizedState,y.componentWillUnmount()}catch(k){K(r,n,k)}}break;case 5:ln(v,v.return);break;case 22:if(v.memoizedState!==null){is(h);continue}}S!==null?(S.return=v,L=S):is(h)}m=m.sibling}e:for(m=null,h=e;;){if(h.tag===5){if(m===null){m=h;try{l=h.stateNode,f?(i=l.style,typeof i.setProperty=="function"?i.setProperty("display","none","important"):i.display="none"):(u=h.stateNode,s=h.memoizedProps.style,o=s!=null&&s.hasOwnProperty("display")?s.display:null,u.style.display=Us("display",o))}catch(k){K(e,e.return,k)}}}else if(h.tag===6){if(m===null)try{h.stateNode.nodeValue=f?"":h.memoizedProps}catch(k){K(e,e.return,k)}}else if((h.tag!==22&&h.tag!==23||h.memoizedState===null||h===e)&&h.child!==null){h.child.return=h,h=h.child;continue}if(h===e)break e;for(;h.sibling===null;){if(h.return===null||h.return===e)break e;m===h&&(m=null),h=h.return}m===h&&(m=null),h.sibling.return=h.return,h=h.sibling}}break;case 19:Ie(t,e),He(e),r&4&&rs(e);break;case 21:break;default:Ie(t,e),He(e)}}function He(e){var t=e.flags;if(t&2){try{e:{for(var n=e.return;n!==null;){if(cc(n)){var r=n;break e}n=n.return}throw Error(g(160))}switch(r.tag){case 5:var l=r.stateNode;r.flags&32&&(Xn(l,""),r.flags&=-33);var i=ns(e);eo(e,i,l);break;case 3:case 4:var o=r.stateNode.containerInfo,u=ns(e);bi(e,u,o);break;default:throw Error(g(161))}}catch(s){K(e,e.return,s)}e.flags&=-3}t&4096&&(e.flags&=-4097)}function Wd(e,t,n){L=e,pc(e)}function pc(e,t,n){for(var r=(e.mode&1)!==0;L!==null;){var l=L,i=l.child;if(l.tag===22&&r){var o=l.memoizedState!==null||jr;if(!o){var u=l.alternate,s=u!==null&&u.memoizedState!==null||ue;u=jr;var f=ue;if(jr=o,(ue=s)&&!f)for(L=l;L!==null;)o=L,s=o.child,o.tag===22&&o.memoizedState!==null?os(l):s!==null?(s.return=o,L=s):os(l);for(;i!==null;)L=i,pc(i),i=i.sibling;L=l,jr=u,ue=f}ls(e)}else l.subtreeFlags&8772&&i!==null?(i.return=l,L=i):ls(e)}}function ls(e){for(;L!==null;){var t=L;if(t.flags&8772){var n=t.alternate;try{if(t.flags&8772)switch(t.tag){case 0:case 11:case 15:ue||Ll(5,t);break;case 1:var r=t.stateNode;if(t.flags&4&&!ue)if(n===null)r.componentDidMount();else{var l=t.elementType===t.type?n.memoizedProps:Oe(t.type,n.memoizedProps);r.componentDidUpdate(l,n.memoizedState,r.__reactInternalSnapshotBeforeUpdate)}var i=t.updateQueue;i!==null&&Wu(t,i,r);break;case 3:var o=t.updateQueue;if(o!==null){if(n=null,t.child!==null)switch(t.child.tag){case 5:n=t.child.stateNode;break;case 1:n=t.child.stateNode}Wu(t,o,n)}break;case 5:var u=t.stateNode;if(n===null&&t.flags&4){n=u;var s=t.memoizedProps;switch(t.type){case"button":case"input":case"select":case"textarea":s.autoFocus&&n.focus();break;case"img":s.src&&(n.src=s.src)}}break;case 6:break;case 4:break;case 12:break;case 13:if(t.memoizedState===null){var f=t.alternate;if(f!==null){var m=f.memoizedState;if(m!==null){var h=m.dehydrated;h!==null&&qn(h)}}}break;case 19:case 17:case 21:case 22:case 23:case 25:break;default:throw Error(g(163))}ue||t.flags&512&&qi(t)}catch(v){K(t,t.return,v)}}if(t===e){L=null;break}if(n=t.sibling,n!==null){n.return=t.return,L=n;break}L=t.return}}function is(e){for(;L!==null;){var t=L;if(t===e){L=null;break}var n=t.sibling;if(n!==null){n.return=t.return,L=n;break}L=t.return}}function os(e){for(;L!==null;){var t=L;try{switch(t.tag){case 0:case 11:case 15:var n=t.return;try{Ll(4,t)}catch(s){K(t,n,s)}break;case 1:var r=t.stateNode;if(typeof r.componentDidMount=="function"){var l=t.return;try{r.componentDidMount()}catch(s){K(t,l,s)}}var i=t.return;try{qi(t)}catch(s){K(t,i,s)}break;case 5:var o=t.return;try{qi(t)}catch(s){K(t,o,s)}}}catch(s){K(t,t.return,s)}if(t===e){L=null;break}var u=t.sibling;if(u!==null){u.return=t.return,L=u;break}L=t.return}}var Bd=Math.ceil,dl=it.ReactCurrentDispatcher,Ho=it.ReactCurrentOwner,Te=it.ReactCurrentBatchConfig,O=0,ee=null,J=null,ne=0,Se=0,on=Nt(0),q=0,ar=null,$t=0,Pl=0,Qo=0,Hn=null,ve=null,Yo=0,wn=1/0,Je=null,pl=!1,to=null,St=null,Rr=!1,vt=null,vl=0,Qn=0,no=null,Hr=-1,Qr=0;function ce(){return O&6?G():Hr!==-1?Hr:Hr=G()}function kt(e){return e.mode&1?O&2&&ne!==0?ne&-ne:Nd.transition!==null?(Qr===0&&(Qr=Zs()),Qr):(e=F,e!==0||(e=window.event,e=e===void 0?16:la(e.type)),e):1}function $e(e,t,n,r){if(50<Qn)throw Qn=0,no=null,Error(g(185));fr(e,n,r),(!(O&2)||e!==ee)&&(e===ee&&(!(O&2)&&(Pl|=n),q===4&&dt(e,ne)),ye(e,r),n===1&&O===0&&!(t.mode&1)&&(wn=G()+500,Cl&&Lt()))}function ye(e,t){var n=e.callbackNode;Nf(e,t);var r=Zr(e,e===ee?ne:0);if(r===0)n!==null&&hu(n),e.callbackNode=null,e.callbackPriority=0;else if(t=r&-r,e.callbackPriority!==t){if(n!=null&&hu(n),t===1)e.tag===0?_d(us.bind(null,e)):xa(us.bind(null,e)),kd(function(){!(O&6)&&Lt()}),n=null;else{switch(qs(r)){case 1:n=yo;break;case 4:n=Gs;break;case 16:n=Jr;break;case 536870912:n=Js;break;default:n=Jr}n=kc(n,vc.bind(null,e))}e.callbackPriority=t,e.callbackNode=n}}function vc(e,t){if(Hr=-1,Qr=0,O&6)throw Error(g(327));var n=e.callbackNode;if(dn()&&e.callbackNode!==n)return null;var r=Zr(e,e===ee?ne:0);if(r===0)return null;if(r&30||r&e.expiredLanes||t)t=hl(e,r);else{t=r;var l=O;O|=2;var i=mc();(ee!==e||ne!==t)&&(Je=null,wn=G()+500,Ot(e,t));do try{Yd();break}catch(u){hc(e,u)}while(!0);Mo(),dl.current=i,O=l,J!==null?t=0:(ee=null,ne=0,t=q)}if(t!==0){if(t===2&&(l=Ti(e),l!==0&&(r=l,t=ro(e,l))),t===1)throw n=ar,Ot(e,0),dt(e,r),ye(e,G()),n;if(t===6)dt(e,r);else{if(l=e.current.alternate,!(r&30)&&!Hd(l)&&(t=hl(e,r),t===2&&(i=Ti(e),i!==0&&(r=i,t=ro(e,i))),t===1))throw n=ar,Ot(e,0),dt(e,r),ye(e,G()),n;switch(e.finishedWork=l,e.finishedLanes=r,t){case 0:case 1:throw Error(g(345));case 2:jt(e,ve,Je);break;case 3:if(dt(e,r),(r&130023424)===r&&(t=Yo+500-G(),10<t)){if(Zr(e,0)!==0)break;if(l=e.suspendedLanes,(l&r)!==r){ce(),e.pingedLanes|=e.suspendedLanes&l;break}e.timeoutHandle=Fi(jt.bind(null,e,ve,Je),t);break}jt(e,ve,Je);break;case 4:if(dt(e,r),(r&4194240)===r)break;for(t=e.eventTimes,l=-1;0<r;){var o=31-Ae(r);i=1<<o,o=t[o],o>l&&(l=o),r&=~i}if(r=l,r=G()-r,r=(120>r?120:480>r?480:1080>r?1080:1920>r?1920:3e3>r?3e3:4320>r?4320:1960*Bd(r/1960))-r,10<r){e.timeoutHandle=Fi(jt.bind(null,e,ve,Je),r);break}jt(e,ve,Je);break;case 5:jt(e,ve,Je);break;default:throw Error(g(329))}}}return ye(e,G()),e.callbackNode===n?vc.bind(null,e):null}function ro(e,t){var n=Hn;return e.current.memoizedState.isDehydrated&&(Ot(e,t).flags|=256),e=hl(e,t),e!==2&&(t=ve,ve=n,t!==null&&lo(t)),e}function lo(e){ve===null?ve=e:ve.push.apply(ve,e)}function Hd(e){for(var t=e;;){if(t.flags&16384){var n=t.updateQueue;if(n!==null&&(n=n.stores,n!==null))for(var r=0;r<n.length;r++){var l=n[r],i=l.getSnapshot;l=l.value;try{if(!We(i(),l))return!1}catch{return!1}}}if(n=t.child,t.subtreeFlags&16384&&n!==null)n.return=t,t=n;else{if(t===e)break;for(;t.sibling===null;){if(t.return===null||t.return===e)return!0;t=t.return}t.sibling.return=t.return,t=t.sibling}}return!0}function dt(e,t){for(t&=~Qo,t&=~Pl,e.suspendedLanes|=t,e.pingedLanes&=~t,e=e.expirationTimes;0<t;){var n=31-Ae(t),r=1<<n;e[n]=-1,t&=~r}}function us(e){if(O&6)throw Error(g(327));dn();var t=Zr(e,0);if(!(t&1))return ye(e,G()),null;var n=hl(e,t);if(e.tag!==0&&n===2){var r=Ti(e);r!==0&&(t=r,n=ro(e,r))}if(n===1)throw n=ar,Ot(e,0),dt(e,t),ye(e,G()),n;if(n===6)throw Error(g(345));return e.finishedWork=e.current.alternate,e.finishedLanes=t,jt(e,ve,Je),ye(e,G()),null}function Ko(e,t){var n=O;O|=1;try{return e(t)}finally{O=n,O===0&&(wn=G()+500,Cl&&Lt())}}function Wt(e){vt!==null&&vt.tag===0&&!(O&6)&&dn();var t=O;O|=1;var n=Te.transition,r=F;try{if(Te.transition=null,F=1,e)return e()}finally{F=r,Te.transition=n,O=t,!(O&6)&&Lt()}}function Xo(){Se=on.current,$(on)}function Ot(e,t){e.finishedWork=null,e.finishedLanes=0;var n=e.timeoutHandle;if(n!==-1&&(e.timeoutHandle=-1,Sd(n)),J!==null)for(n=J.return;n!==null;){var r=n;switch(Po(r),r.tag){case 1:r=r.type.childContextTypes,r!=null&&nl();break;case 3:gn(),$(me),$(se),Fo();break;case 5:Oo(r);break;case 4:gn();break;case 13:$(H);break;case 19:$(H);break;case 10:jo(r.type._context);break;case 22:case 23:Xo()}n=n.return}if(ee=e,J=e=Et(e.current,null),ne=Se=t,q=0,ar=null,Qo=Pl=$t=0,ve=Hn=null,Dt!==null){for(t=0;t<Dt.length;t++)if(n=Dt[t],r=n.interleaved,r!==null){n.interleaved=null;var l=r.next,i=n.pending;if(i!==null){var o=i.next;i.next=l,r.next=o}n.pending=r}Dt=null}return e}function hc(e,t){do{var n=J;try{if(Mo(),$r.current=fl,cl){for(var r=Q.memoizedState;r!==null;){var l=r.queue;l!==null&&(l.pending=null),r=r.next}cl=!1}if(At=0,b=Z=Q=null,Wn=!1,or=0,Ho.current=null,n===null||n.return===null){q=1,ar=t,J=null;break}e:{var i=e,o=n.return,u=n,s=t;if(t=ne,u.flags|=32768,s!==null&&typeof s=="object"&&typeof s.then=="function"){var f=s,m=u,h=m.tag;if(!(m.mode&1)&&(h===0||h===11||h===15)){var v=m.alternate;v?(m.updateQueue=v.updateQueue,m.memoizedState=v.memoizedState,m.lanes=v.lanes):(m.updateQueue=null,m.memoizedState=null)}var S=Xu(o);if(S!==null){S.flags&=-257,Gu(S,o,u,i,t),S.mode&1&&Ku(i,f,t),t=S,s=f;var y=t.updateQueue;if(y===null){var k=new Set;k.add(s),t.updateQueue=k}else y.add(s);break e}else{if(!(t&1)){Ku(i,f,t),Go();break e}s=Error(g(426))}}else if(W&&u.mode&1){var D=Xu(o);if(D!==null){!(D.flags&65536)&&(D.flags|=256),Gu(D,o,u,i,t),To(yn(s,u));break e}}i=s=yn(s,u),q!==4&&(q=2),Hn===null?Hn=[i]:Hn.push(i),i=o;do{switch(i.tag){case 3:i.flags|=65536,t&=-t,i.lanes|=t;var d=qa(i,s,t);$u(i,d);break e;case 1:u=s;var a=i.type,c=i.stateNode;if(!(i.flags&128)&&(typeof a.getDerivedStateFromError=="function"||c!==null&&typeof c.componentDidCatch=="function"&&(St===null||!St.has(c)))){i.flags|=65536,t&=-t,i.lanes|=t;var p=ba(i,u,t);$u(i,p);break e}}i=i.return}while(i!==null)}yc(n)}catch(C){t=C,J===n&&n!==null&&(J=n=n.return);continue}break}while(!0)}function mc(){var e=dl.current;return dl.current=fl,e===null?fl:e}function Go(){(q===0||q===3||q===2)&&(q=4),ee===null||!($t&268435455)&&!(Pl&268435455)||dt(ee,ne)}function hl(e,t){var n=O;O|=2;var r=mc();(ee!==e||ne!==t)&&(Je=null,Ot(e,t));do try{Qd();break}catch(l){hc(e,l)}while(!0);if(Mo(),O=n,dl.current=r,J!==null)throw Error(g(261));return ee=null,ne=0,q}function Qd(){for(;J!==null;)gc(J)}function Yd(){for(;J!==null&&!gf();)gc(J)}function gc(e){var t=Sc(e.alternate,e,Se);e.memoizedProps=e.pendingProps,t===null?yc(e):J=t,Ho.current=null}function yc(e){var t=e;do{var n=t.alternate;if(e=t.return,t.flags&32768){if(n=Vd(n,t),n!==null){n.flags&=32767,J=n;return}if(e!==null)e.flags|=32768,e.subtreeFlags=0,e.deletions=null;else{q=6,J=null;return}}else if(n=Ud(n,t,Se),n!==null){J=n;return}if(t=t.sibling,t!==null){J=t;return}J=t=e}while(t!==null);q===0&&(q=5)}function jt(e,t,n){var r=F,l=Te.transition;try{Te.transition=null,F=1,Kd(e,t,n,r)}finally{Te.transition=l,F=r}return null}function Kd(e,t,n,r){do dn();while(vt!==null);if(O&6)throw Error(g(327));n=e.finishedWork;var l=e.finishedLanes;if(n===null)return null;if(e.finishedWork=null,e.finishedLanes=0,n===e.current)throw Error(g(177));e.callbackNode=null,e.callbackPriority=0;var i=n.lanes|n.childLanes;if(Lf(e,i),e===ee&&(J=ee=null,ne=0),!(n.subtreeFlags&2064)&&!(n.flags&2064)||Rr||(Rr=!0,kc(Jr,function(){return dn(),null})),i=(n.flags&15990)!==0,n.subtreeFlags&15990||i){i=Te.transition,Te.transition=null;var o=F;F=1;var u=O;O|=4,Ho.current=null,$d(e,n),dc(n,e),pd(Ii),qr=!!Di,Ii=Di=null,e.current=n,Wd(n),yf(),O=u,F=o,Te.transition=i}else e.current=n;if(Rr&&(Rr=!1,vt=e,vl=l),i=e.pendingLanes,i===0&&(St=null),kf(n.stateNode),ye(e,G()),t!==null)for(r=e.onRecoverableError,n=0;n<t.length;n++)l=t[n],r(l.value,{componentStack:l.stack,digest:l.digest});if(pl)throw pl=!1,e=to,to=null,e;return vl&1&&e.tag!==0&&dn(),i=e.pendingLanes,i&1?e===no?Qn++:(Qn=0,no=e):Qn=0,Lt(),null}function dn(){if(vt!==null){var e=qs(vl),t=Te.transition,n=F;try{if(Te.transition=null,F=16>e?16:e,vt===null)var r=!1;else{if(e=vt,vt=null,vl=0,O&6)throw Error(g(331));var l=O;for(O|=4,L=e.current;L!==null;){var i=L,o=i.child;if(L.flags&16){var u=i.deletions;if(u!==null){for(var s=0;s<u.length;s++){var f=u[s];for(L=f;L!==null;){var m=L;switch(m.tag){case 0:case 11:case 15:Bn(8,m,i)}var h=m.child;if(h!==null)h.return=m,L=h;else for(;L!==null;){m=L;var v=m.sibling,S=m.return;if(ac(m),m===f){L=null;break}if(v!==null){v.return=S,L=v;break}L=S}}}var y=i.alternate;if(y!==null){var k=y.child;if(k!==null){y.child=null;do{var D=k.sibling;k.sibling=null,k=D}while(k!==null)}}L=i}}if(i.subtreeFlags&2064&&o!==null)o.return=i,L=o;else e:for(;L!==null;){if(i=L,i.flags&2048)switch(i.tag){case 0:case 11:case 15:Bn(9,i,i.return)}var d=i.sibling;if(d!==null){d.return=i.return,L=d;break e}L=i.return}}var a=e.current;for(L=a;L!==null;){o=L;var c=o.child;if(o.subtreeFlags&2064&&c!==null)c.return=o,L=c;else e:for(o=a;L!==null;){if(u=L,u.flags&2048)try{switch(u.tag){case 0:case 11:case 15:Ll(9,u)}}catch(C){K(u,u.return,C)}if(u===o){L=null;break e}var p=u.sibling;if(p!==null){p.return=u.return,L=p;break e}L=u.return}}if(O=l,Lt(),Ke&&typeof Ke.onPostCommitFiberRoot=="function")try{Ke.onPostCommitFiberRoot(wl,e)}catch{}r=!0}return r}finally{F=n,Te.transition=t}}return!1}function ss(e,t,n){t=yn(n,t),t=qa(e,t,1),e=wt(e,t,1),t=ce(),e!==null&&(fr(e,1,t),ye(e,t))}function K(e,t,n){if(e.tag===3)ss(e,e,n);else for(;t!==null;){if(t.tag===3){ss(t,e,n);break}else if(t.tag===1){var r=t.stateNode;if(typeof t.type.getDerivedStateFromError=="function"||typeof r.componentDidCatch=="function"&&(St===null||!St.has(r))){e=yn(n,e),e=ba(t,e,1),t=wt(t,e,1),e=ce(),t!==null&&(fr(t,1,e),ye(t,e));break}}t=t.return}}function Xd(e,t,n){var r=e.pingCache;r!==null&&r.delete(t),t=ce(),e.pingedLanes|=e.suspendedLanes&n,ee===e&&(ne&n)===n&&(q===4||q===3&&(ne&130023424)===ne&&500>G()-Yo?Ot(e,0):Qo|=n),ye(e,t)}function wc(e,t){t===0&&(e.mode&1?(t=xr,xr<<=1,!(xr&130023424)&&(xr=4194304)):t=1);var n=ce();e=rt(e,t),e!==null&&(fr(e,t,n),ye(e,n))}function Gd(e){var t=e.memoizedState,n=0;t!==null&&(n=t.retryLane),wc(e,n)}function Jd(e,t){var n=0;switch(e.tag){case 13:var r=e.stateNode,l=e.memoizedState;l!==null&&(n=l.retryLane);break;case 19:r=e.stateNode;break;default:throw Error(g(314))}r!==null&&r.delete(t),wc(e,n)}var Sc;Sc=function(e,t,n){if(e!==null)if(e.memoizedProps!==t.pendingProps||me.current)he=!0;else{if(!(e.lanes&n)&&!(t.flags&128))return he=!1,Fd(e,t,n);he=!!(e.flags&131072)}else he=!1,W&&t.flags&1048576&&Ca(t,il,t.index);switch(t.lanes=0,t.tag){case 2:var r=t.type;Br(e,t),e=t.pendingProps;var l=vn(t,se.current);fn(t,n),l=Vo(null,t,r,e,l,n);var i=Ao();return t.flags|=1,typeof l=="object"&&l!==null&&typeof l.render=="function"&&l.$$typeof===void 0?(t.tag=1,t.memoizedState=null,t.updateQueue=null,ge(r)?(i=!0,rl(t)):i=!1,t.memoizedState=l.state!==null&&l.state!==void 0?l.state:null,Do(t),l.updater=Nl,t.stateNode=l,l._reactInternals=t,Hi(t,r,e,n),t=Ki(null,t,r,!0,i,n)):(t.tag=0,W&&i&&Lo(t),ae(null,t,l,n),t=t.child),t;case 16:r=t.elementType;e:{switch(Br(e,t),e=t.pendingProps,l=r._init,r=l(r._payload),t.type=r,l=t.tag=qd(r),e=Oe(r,e),l){case 0:t=Yi(null,t,r,e,n);break e;case 1:t=qu(null,t,r,e,n);break e;case 11:t=Ju(null,t,r,e,n);break e;case 14:t=Zu(null,t,r,Oe(r.type,e),n);break e}throw Error(g(306,r,""))}return t;case 0:return r=t.type,l=t.pendingProps,l=t.elementType===r?l:Oe(r,l),Yi(e,t,r,l,n);case 1:return r=t.type,l=t.pendingProps,l=t.elementType===r?l:Oe(r,l),qu(e,t,r,l,n);case 3:e:{if(rc(t),e===null)throw Error(g(387));r=t.pendingProps,i=t.memoizedState,l=i.element,za(e,t),sl(t,r,null,n);var o=t.memoizedState;if(r=o.element,i.isDehydrated)if(i={element:r,isDehydrated:!1,cache:o.cache,pendingSuspenseBoundaries:o.pendingSuspenseBoundaries,transitions:o.transitions},t.updateQueue.baseState=i,t.memoizedState=i,t.flags&256){l=yn(Error(g(423)),t),t=bu(e,t,r,n,l);break e}else if(r!==l){l=yn(Error(g(424)),t),t=bu(e,t,r,n,l);break e}else for(ke=yt(t.stateNode.containerInfo.firstChild),Ee=t,W=!0,Ue=null,n=Pa(t,null,r,n),t.child=n;n;)n.flags=n.flags&-3|4096,n=n.sibling;else{if(hn(),r===l){t=lt(e,t,n);break e}ae(e,t,r,n)}t=t.child}return t;case 5:return Ma(t),e===null&&$i(t),r=t.type,l=t.pendingProps,i=e!==null?e.memoizedProps:null,o=l.children,Oi(r,l)?o=null:i!==null&&Oi(r,i)&&(t.flags|=32),nc(e,t),ae(e,t,o,n),t.child;case 6:return e===null&&$i(t),null;case 13:return lc(e,t,n);case 4:return Io(t,t.stateNode.containerInfo),r=t.pendingProps,e===null?t.child=mn(t,null,r,n):ae(e,t,r,n),t.child;case 11:return r=t.type,l=t.pendingProps,l=t.elementType===r?l:Oe(r,l),Ju(e,t,r,l,n);case 7:return ae(e,t,t.pendingProps,n),t.child;case 8:return ae(e,t,t.pendingProps.children,n),t.child;case 12:return ae(e,t,t.pendingProps.children,n),t.child;case 10:e:{if(r=t.type._context,l=t.pendingProps,i=t.memoizedProps,o=l.value,V(ol,r._currentValue),r._currentValue=o,i!==null)if(We(i.value,o)){if(i.children===l.children&&!me.current){t=lt(e,t,n);break e}}else for(i=t.child,i!==null&&(i.return=t);i!==null;){var u=i.dependencies;if(u!==null){o=i.child;for(var s=u.firstContext;s!==null;){if(s.context===r){if(i.tag===1){s=et(-1,n&-n),s.tag=2;var f=i.updateQueue;if(f!==null){f=f.shared;var m=f.pending;m===null?s.next=s:(s.next=m.next,m.next=s),f.pending=s}}i.lanes|=n,s=i.alternate,s!==null&&(s.lanes|=n),Wi(i.return,n,t),u.lanes|=n;break}s=s.next}}else if(i.tag===10)o=i.type===t.type?null:i.child;else if(i.tag===18){if(o=i.return,o===null)throw Error(g(341));o.lanes|=n,u=o.alternate,u!==null&&(u.lanes|=n),Wi(o,n,t),o=i.sibling}else o=i.child;if(o!==null)o.return=i;else for(o=i;o!==null;){if(o===t){o=null;break}if(i=o.sibling,i!==null){i.return=o.return,o=i;break}o=o.return}i=o}ae(e,t,l.children,n),t=t.child}return t;case 9:return l=t.type,r=t.pendingProps.children,fn(t,n),l=ze(l),r=r(l),t.flags|=1,ae(e,t,r,n),t.child;case 14:return r=t.type,l=Oe(r,t.pendingProps),l=Oe(r.type,l),Zu(e,t,r,l,n);case 15:return ec(e,t,t.type,t.pendingProps,n);case 17:return r=t.type,l=t.pendingProps,l=t.elementType===r?l:Oe(r,l),Br(e,t),t.tag=1,ge(r)?(e=!0,rl(t)):e=!1,fn(t,n),Za(t,r,l),Hi(t,r,l,n),Ki(null,t,r,!0,e,n);case 19:return ic(e,t,n);case 22:return tc(e,t,n)}throw Error(g(156,t.tag))};function kc(e,t){return Xs(e,t)}function Zd(e,t,n,r){this.tag=e,this.key=n,this.sibling=this.child=this.return=this.stateNode=this.type=this.elementType=null,this.index=0,this.ref=null,this.pendingProps=t,this.dependencies=this.memoizedState=this.updateQueue=this.memoizedProps=null,this.mode=r,this.subtreeFlags=this.flags=0,this.deletions=null,this.childLanes=this.lanes=0,this.alternate=null}function Pe(e,t,n,r){return new Zd(e,t,n,r)}function Jo(e){return e=e.prototype,!(!e||!e.isReactComponent)}function qd(e){if(typeof e=="function")return Jo(e)?1:0;if(e!=null){if(e=e.$$typeof,e===ho)return 11;if(e===mo)return 14}return 2}function Et(e,t){var n=e.alternate;return n===null?(n=Pe(e.tag,t,e.key,e.mode),n.elementType=e.elementType,n.type=e.type,n.stateNode=e.stateNode,n.alternate=e,e.alternate=n):(n.pendingProps=t,n.type=e.type,n.flags=0,n.subtreeFlags=0,n.deletions=null),n.flags=e.flags&14680064,n.childLanes=e.childLanes,n.lanes=e.lanes,n.child=e.child,n.memoizedProps=e.memoizedProps,n.memoizedState=e.memoizedState,n.updateQueue=e.updateQueue,t=e.dependencies,n.dependencies=t===null?null:{lanes:t.lanes,firstContext:t.firstContext},n.sibling=e.sibling,n.index=e.index,n.ref=e.ref,n}function Yr(e,t,n,r,l,i){var o=2;if(r=e,typeof e=="function")Jo(e)&&(o=1);else if(typeof e=="string")o=5;else e:switch(e){case Gt:return Ft(n.children,l,i,t);case vo:o=8,l|=8;break;case vi:return e=Pe(12,n,t,l|2),e.elementType=vi,e.lanes=i,e;case hi:return e=Pe(13,n,t,l),e.elementType=hi,e.lanes=i,e;case mi:return e=Pe(19,n,t,l),e.elementType=mi,e.lanes=i,e;case Ms:return Tl(n,l,i,t);default:if(typeof e=="object"&&e!==null)switch(e.$$typeof){case Ts:o=10;break e;case zs:o=9;break e;case ho:o=11;break e;case mo:o=14;break e;case at:o=16,r=null;break e}throw Error(g(130,e==null?e:typeof e,""))}return t=Pe(o,n,t,l),t.elementType=e,t.type=r,t.lanes=i,t}function Ft(e,t,n,r){return e=Pe(7,e,r,t),e.lanes=n,e}function Tl(e,t,n,r){return e=Pe(22,e,r,t),e.elementType=Ms,e.lanes=n,e.stateNode={isHidden:!1},e}function si(e,t,n){return e=Pe(6,e,null,t),e.lanes=n,e}function ai(e,t,n){return t=Pe(4,e.children!==null?e.children:[],e.key,t),t.lanes=n,t.stateNode={containerInfo:e.containerInfo,pendingChildren:null,implementation:e.implementation},t}function bd(e,t,n,r,l){this.tag=t,this.containerInfo=e,this.finishedWork=this.pingCache=this.current=this.pendingChildren=null,this.timeoutHandle=-1,this.callbackNode=this.pendingContext=this.context=null,this.callbackPriority=0,this.eventTimes=Bl(0),this.expirationTimes=Bl(-1),this.entangledLanes=this.finishedLanes=this.mutableReadLanes=this.expiredLanes=this.pingedLanes=this.suspendedLanes=this.pendingLanes=0,this.entanglements=Bl(0),this.identifierPrefix=r,this.onRecoverableError=l,this.mutableSourceEagerHydrationData=null}function Zo(e,t,n,r,l,i,o,u,s){return e=new bd(e,t,n,u,s),t===1?(t=1,i===!0&&(t|=8)):t=0,i=Pe(3,null,null,t),e.current=i,i.stateNode=e,i.memoizedState={element:r,isDehydrated:n,cache:null,transitions:null,pendingSuspenseBoundaries:null},Do(i),e}function ep(e,t,n){var r=3<arguments.length&&arguments[3]!==void 0?arguments[3]:null;return{$$typeof:Xt,key:r==null?null:""+r,children:e,containerInfo:t,implementation:n}}function Ec(e){if(!e)return Ct;e=e._reactInternals;e:{if(Ht(e)!==e||e.tag!==1)throw Error(g(170));var t=e;do{switch(t.tag){case 3:t=t.stateNode.context;break e;case 1:if(ge(t.type)){t=t.stateNode.__reactInternalMemoizedMergedChildContext;break e}}t=t.return}while(t!==null);throw Error(g(171))}if(e.tag===1){var n=e.type;if(ge(n))return Ea(e,n,t)}return t}function xc(e,t,n,r,l,i,o,u,s){return e=Zo(n,r,!0,e,l,i,o,u,s),e.context=Ec(null),n=e.current,r=ce(),l=kt(n),i=et(r,l),i.callback=t??null,wt(n,i,l),e.current.lanes=l,fr(e,l,r),ye(e,r),e}function zl(e,t,n,r){var l=t.current,i=ce(),o=kt(l);return n=Ec(n),t.context===null?t.context=n:t.pendingContext=n,t=et(i,o),t.payload={element:e},r=r===void 0?null:r,r!==null&&(t.callback=r),e=wt(l,t,o),e!==null&&($e(e,l,o,i),Ar(e,l,o)),o}function ml(e){if(e=e.current,!e.child)return null;switch(e.child.tag){case 5:return e.child.stateNode;default:return e.child.stateNode}}function as(e,t){if(e=e.memoizedState,e!==null&&e.dehydrated!==null){var n=e.retryLane;e.retryLane=n!==0&&n<t?n:t}}function qo(e,t){as(e,t),(e=e.alternate)&&as(e,t)}function tp(){return null}var Cc=typeof reportError=="function"?reportError:function(e){console.error(e)};function bo(e){this._internalRoot=e}Ml.prototype.render=bo.prototype.render=function(e){var t=this._internalRoot;if(t===null)throw Error(g(409));zl(e,t,null,null)};Ml.prototype.unmount=bo.prototype.unmount=function(){var e=this._internalRoot;if(e!==null){this._internalRoot=null;var t=e.containerInfo;Wt(function(){zl(null,e,null,null)}),t[nt]=null}};function Ml(e){this._internalRoot=e}Ml.prototype.unstable_scheduleHydration=function(e){if(e){var t=ta();e={blockedOn:null,target:e,priority:t};for(var n=0;n<ft.length&&t!==0&&t<ft[n].priority;n++);ft.splice(n,0,e),n===0&&ra(e)}};function eu(e){return!(!e||e.nodeType!==1&&e.nodeType!==9&&e.nodeType!==11)}function jl(e){return!(!e||e.nodeType!==1&&e.nodeType!==9&&e.nodeType!==11&&(e.nodeType!==8||e.nodeValue!==" react-mount-point-unstable "))}function cs(){}function np(e,t,n,r,l){if(l){if(typeof r=="function"){var i=r;r=function(){var f=ml(o);i.call(f)}}var o=xc(t,r,e,0,null,!1,!1,"",cs);return e._reactRootContainer=o,e[nt]=o.current,tr(e.nodeType===8?e.parentNode:e),Wt(),o}for(;l=e.lastChild;)e.removeChild(l);if(typeof r=="function"){var u=r;r=function(){var f=ml(s);u.call(f)}}var s=Zo(e,0,!1,null,null,!1,!1,"",cs);return e._reactRootContainer=s,e[nt]=s.current,tr(e.nodeType===8?e.parentNode:e),Wt(function(){zl(t,s,n,r)}),s}function Rl(e,t,n,r,l){var i=n._reactRootContainer;if(i){var o=i;if(typeof l=="function"){var u=l;l=function(){var s=ml(o);u.call(s)}}zl(t,o,e,l)}else o=np(n,t,e,l,r);return ml(o)}bs=function(e){switch(e.tag){case 3:var t=e.stateNode;if(t.current.memoizedState.isDehydrated){var n=In(t.pendingLanes);n!==0&&(wo(t,n|1),ye(t,G()),!(O&6)&&(wn=G()+500,Lt()))}break;case 13:Wt(function(){var r=rt(e,1);if(r!==null){var l=ce();$e(r,e,1,l)}}),qo(e,1)}};So=function(e){if(e.tag===13){var t=rt(e,134217728);if(t!==null){var n=ce();$e(t,e,134217728,n)}qo(e,134217728)}};ea=function(e){if(e.tag===13){var t=kt(e),n=rt(e,t);if(n!==null){var r=ce();$e(n,e,t,r)}qo(e,t)}};ta=function(){return F};na=function(e,t){var n=F;try{return F=e,t()}finally{F=n}};Ni=function(e,t,n){switch(t){case"input":if(wi(e,n),t=n.name,n.type==="radio"&&t!=null){for(n=e;n.parentNode;)n=n.parentNode;for(n=n.querySelectorAll("input[name="+JSON.stringify(""+t)+'][type="radio"]'),t=0;t<n.length;t++){var r=n[t];if(r!==e&&r.form===e.form){var l=xl(r);if(!l)throw Error(g(90));Rs(r),wi(r,l)}}}break;case"textarea":Is(e,n);break;case"select":t=n.value,t!=null&&un(e,!!n.multiple,t,!1)}};Ws=Ko;Bs=Wt;var rp={usingClientEntryPoint:!1,Events:[pr,bt,xl,As,$s,Ko]},jn={findFiberByHostInstance:Rt,bundleType:0,version:"18.3.1",rendererPackageName:"react-dom"},lp={bundleType:jn.bundleType,version:jn.version,rendererPackageName:jn.rendererPackageName,rendererConfig:jn.rendererConfig,overrideHookState:null,overrideHookStateDeletePath:null,overrideHookStateRenamePath:null,overrideProps:null,overridePropsDeletePath:null,overridePropsRenamePath:null,setErrorHandler:null,setSuspenseHandler:null,scheduleUpdate:null,currentDispatcherRef:it.ReactCurrentDispatcher,findHostInstanceByFiber:function(e){return e=Ys(e),e===null?null:e.stateNode},findFiberByHostInstance:jn.findFiberByHostInstance||tp,findHostInstancesForRefresh:null,scheduleRefresh:null,scheduleRoot:null,setRefreshHandler:null,getCurrentFiber:null,reconcilerVersion:"18.3.1-next-f1338f8080-20240426"};if(typeof __REACT_DEVTOOLS_GLOBAL_HOOK__<"u"){var Dr=__REACT_DEVTOOLS_GLOBAL_HOOK__;if(!Dr.isDisabled&&Dr.supportsFiber)try{wl=Dr.inject(lp),Ke=Dr}catch{}}Ce.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED=rp;Ce.createPortal=function(e,t){var n=2<arguments.length&&arguments[2]!==void 0?arguments[2]:null;if(!eu(t))throw Error(g(200));return ep(e,t,null,n)};Ce.createRoot=function(e,t){if(!eu(e))throw Error(g(299));var n=!1,r="",l=Cc;return t!=null&&(t.unstable_strictMode===!0&&(n=!0),t.identifierPrefix!==void 0&&(r=t.identifierPrefix),t.onRecoverableError!==void 0&&(l=t.onRecoverableError)),t=Zo(e,1,!1,null,null,n,!1,r,l),e[nt]=t.current,tr(e.nodeType===8?e.parentNode:e),new bo(t)};Ce.findDOMNode=function(e){if(e==null)return null;if(e.nodeType===1)return e;var t=e._reactInternals;if(t===void 0)throw typeof e.render=="function"?Error(g(188)):(e=Object.keys(e).join(","),Error(g(268,e)));return e=Ys(t),e=e===null?null:e.stateNode,e};Ce.flushSync=function(e){return Wt(e)};Ce.hydrate=function(e,t,n){if(!jl(t))throw Error(g(200));return Rl(null,e,t,!0,n)};Ce.hydrateRoot=function(e,t,n){if(!eu(e))throw Error(g(405));var r=n!=null&&n.hydratedSources||null,l=!1,i="",o=Cc;if(n!=null&&(n.unstable_strictMode===!0&&(l=!0),n.identifierPrefix!==void 0&&(i=n.identifierPrefix),n.onRecoverableError!==void 0&&(o=n.onRecoverableError)),t=xc(t,null,e,1,n??null,l,!1,i,o),e[nt]=t.current,tr(e),r)for(e=0;e<r.length;e++)n=r[e],l=n._getVersion,l=l(n._source),t.mutableSourceEagerHydrationData==null?t.mutableSourceEagerHydrationData=[n,l]:t.mutableSourceEagerHydrationData.push(n,l);return new Ml(t)};Ce.render=function(e,t,n){if(!jl(t))throw Error(g(200));return Rl(null,e,t,!1,n)};Ce.unmountComponentAtNode=function(e){if(!jl(e))throw Error(g(40));return e._reactRootContainer?(Wt(function(){Rl(null,null,e,!1,function(){e._reactRootContainer=null,e[nt]=null})}),!0):!1};Ce.unstable_batchedUpdates=Ko;Ce.unstable_renderSubtreeIntoContainer=function(e,t,n,r){if(!jl(n))throw Error(g(200));if(e==null||e._reactInternals===void 0)throw Error(g(38));return Rl(e,t,n,!1,r)};Ce.version="18.3.1-next-f1338f8080-20240426";function _c(){if(!(typeof __REACT_DEVTOOLS_GLOBAL_HOOK__>"u"||typeof __REACT_DEVTOOLS_GLOBAL_HOOK__.checkDCE!="function"))try{__REACT_DEVTOOLS_GLOBAL_HOOK__.checkDCE(_c)}catch(e){console.error(e)}}_c(),_s.exports=Ce;var ip=_s.exports,fs=ip;di.createRoot=fs.createRoot,di.hydrateRoot=fs.hydrateRoot;const Yn="valueChanged",Nc="propertiesChanged",op="sliderDragStarted",up="sliderDragEnded";class gl{constructor(){pe(this,"listeners",new Map);pe(this,"listenerId",0)}addListener(t){const n=this.listenerId++;return this.listeners.set(n,t),n}removeListener(t){this.listeners.delete(t)}callListeners(t){for(const n of this.listeners.values())n(t)}}function Ve(){return typeof window.__JUCE__<"u"&&typeof window.__JUCE__.backend<"u"}const tu=Ve;class sp{constructor(t){pe(this,"name");pe(this,"identifier");pe(this,"scaledValue",0);pe(this,"properties",{start:0,end:1,skew:1,name:"",label:"",numSteps:100,interval:0,parameterIndex:-1});pe(this,"valueChangedEvent",new gl);pe(this,"propertiesChangedEvent",new gl);this.name=t,this.identifier="__juce__slider"+t,Ve()&&(window.__JUCE__.backend.addEventListener(this.identifier,n=>this.handleEvent(n)),window.__JUCE__.backend.emitEvent(this.identifier,{eventType:"requestInitialUpdate"}))}setNormalisedValue(t){this.scaledValue=this.snapToLegalValue(this.normalisedToScaledValue(t)),Ve()&&window.__JUCE__.backend.emitEvent(this.identifier,{eventType:Yn,value:this.scaledValue})}setScaledValue(t){this.scaledValue=this.snapToLegalValue(t),Ve()&&window.__JUCE__.backend.emitEvent(this.identifier,{eventType:Yn,value:this.scaledValue})}sliderDragStarted(){Ve()&&window.__JUCE__.backend.emitEvent(this.identifier,{eventType:op})}sliderDragEnded(){Ve()&&window.__JUCE__.backend.emitEvent(this.identifier,{eventType:up})}handleEvent(t){if(t.eventType===Yn&&(this.scaledValue=t.value,this.valueChangedEvent.callListeners()),t.eventType===Nc){const{eventType:n,...r}=t;this.properties=r,this.propertiesChangedEvent.callListeners()}}getScaledValue(){return this.scaledValue}getNormalisedValue(){const t=this.properties.end-this.properties.start;return t===0?0:Math.pow((this.scaledValue-this.properties.start)/t,this.properties.skew)}getProperties(){return{...this.properties}}normalisedToScaledValue(t){return Math.pow(t,1/this.properties.skew)*(this.properties.end-this.properties.start)+this.properties.start}snapToLegalValue(t){const n=this.properties.interval;if(n===0)return t;const r=this.properties.start;return((i,o=0,u=1)=>Math.max(o,Math.min(u,i)))(r+n*Math.floor((t-r)/n+.5),this.properties.start,this.properties.end)}}class ap{constructor(t){pe(this,"name");pe(this,"identifier");pe(this,"_value",!1);pe(this,"valueChangedEvent",new gl);pe(this,"propertiesChangedEvent",new gl);this.name=t,this.identifier="__juce__toggle"+t,Ve()&&(window.__JUCE__.backend.addEventListener(this.identifier,n=>this.handleEvent(n)),window.__JUCE__.backend.emitEvent(this.identifier,{eventType:"requestInitialUpdate"}))}getValue(){return this._value}setValue(t){this._value=t,Ve()&&window.__JUCE__.backend.emitEvent(this.identifier,{eventType:Yn,value:this._value})}handleEvent(t){t.eventType===Yn&&(this._value=t.value,this.valueChangedEvent.callListeners()),t.eventType===Nc&&this.propertiesChangedEvent.callListeners()}}const ci=new Map,fi=new Map;function Lc(e){return ci.has(e)||ci.set(e,new sp(e)),ci.get(e)}function cp(e){return fi.has(e)||fi.set(e,new ap(e)),fi.get(e)}function io(e,t){if(!Ve())return console.log("[JUCE Bridge] Not in WebView, custom event listener ignored:",e),()=>{};const n=window.__JUCE__.backend.addEventListener(e,t);return()=>{window.__JUCE__.backend.removeEventListener(n)}}const fp=io;function ds(e,t){if(!Ve()){console.log("[JUCE Bridge] Not in WebView, emitEvent ignored:",e,t);return}window.__JUCE__.backend.emitEvent(e,t)}function st(e,t=.5){const[n,r]=z.useState(t),l=z.useRef(Lc(e)),i=tu();z.useEffect(()=>{const f=l.current;i&&r(f.getScaledValue());const m=f.valueChangedEvent.addListener(()=>{r(f.getScaledValue())});return()=>{f.valueChangedEvent.removeListener(m)}},[i]);const o=z.useCallback(f=>{r(f),l.current.setScaledValue(f)},[]),u=z.useCallback(()=>{l.current.sliderDragStarted()},[]),s=z.useCallback(()=>{l.current.sliderDragEnded()},[]);return{value:n,setValue:o,dragStart:u,dragEnd:s,isConnected:i}}function dp(e,t=!1){const[n,r]=z.useState(t),l=z.useRef(cp(e)),i=tu();z.useEffect(()=>{const s=l.current;i&&r(s.getValue());const f=s.valueChangedEvent.addListener(()=>{r(s.getValue())});return()=>{s.valueChangedEvent.removeListener(f)}},[i]);const o=z.useCallback(s=>{r(s),l.current.setValue(s)},[]),u=z.useCallback(()=>{const s=!l.current.getValue();o(s)},[o]);return{value:n,setValue:o,toggle:u,isConnected:i}}function ps(e,t,n=1){const[r,l]=z.useState(n),i=z.useRef(Lc(e)),o=tu();z.useEffect(()=>{const s=i.current;o&&l(Math.round(s.getScaledValue()));const f=s.valueChangedEvent.addListener(()=>{l(Math.round(s.getScaledValue()))});return()=>{s.valueChangedEvent.removeListener(f)}},[o]);const u=z.useCallback(s=>{l(s),i.current.setScaledValue(s)},[]);return{value:r,setChoice:u,isConnected:o}}const pp={inputLevel:0,duckEnvelope:0,tap1Level:0,tap2Level:0,tap3Level:0,tap4Level:0};function vp(){const[e,t]=z.useState(pp);return z.useEffect(()=>{if(!Ve()){let r,l=0;const i=()=>{l+=.016;const u=.2+(Math.sin(l*2)*.5+.5)*.5,s=Math.sin(l*.3)*.5;t({inputLevel:u,duckEnvelope:s,tap1Level:u*.7,tap2Level:u*.5,tap3Level:u*.3,tap4Level:u*.15}),r=requestAnimationFrame(i)};return i(),()=>cancelAnimationFrame(r)}return fp("visualizerData",r=>{const l=r;l&&typeof l=="object"&&t({inputLevel:l.inputLevel??0,duckEnvelope:l.duckEnvelope??0,tap1Level:l.tap1Level??0,tap2Level:l.tap2Level??0,tap3Level:l.tap3Level??0,tap4Level:l.tap4Level??0})})},[]),e}function hp({onActivated:e}){const[t,n]=z.useState("checking"),[r,l]=z.useState(""),[i,o]=z.useState(""),[u,s]=z.useState(null),[f,m]=z.useState(!1);z.useEffect(()=>{const y=setTimeout(()=>m(!0),100);return()=>clearTimeout(y)},[]),z.useEffect(()=>{const y=io("activationState",D=>{var a;const d=D;if(!d.isConfigured){e();return}d.isActivated&&((a=d.info)!=null&&a.isValid)?(s(d.info),n("success"),setTimeout(e,1500)):n("input")}),k=io("activationResult",D=>{const d=D;switch(d.status){case"valid":case"already_active":s(d.info||null),n("success"),setTimeout(e,1500);break;case"invalid":o("Invalid license key. Please check and try again."),n("error");break;case"revoked":o("This license has been revoked."),n("error");break;case"max_reached":o("Maximum activations reached. Deactivate another device first."),n("error");break;case"network_error":o("Network error. Please check your connection."),n("error");break;case"server_error":o("Server error. Please try again later."),n("error");break;default:o("Activation failed. Please try again."),n("error")}});return ds("getActivationStatus",{}),()=>{y(),k()}},[e]);const h=z.useCallback(()=>{const y=r.trim();y&&(n("activating"),o(""),ds("activateLicense",{code:y}))},[r]),v=z.useCallback(y=>{y.key==="Enter"&&h()},[h]),S=z.useCallback(()=>{n("input"),o("")},[]);return w.jsxs("div",{className:`activation-screen ${f?"visible":""}`,children:[w.jsxs("div",{className:"activation-bg",children:[w.jsx("div",{className:"activation-glow glow-1"}),w.jsx("div",{className:"activation-glow glow-2"}),w.jsx("div",{className:"activation-glow glow-3"}),w.jsx("div",{className:"sand-particle p1"}),w.jsx("div",{className:"sand-particle p2"}),w.jsx("div",{className:"sand-particle p3"}),w.jsx("div",{className:"sand-particle p4"}),w.jsx("div",{className:"sand-particle p5"})]}),w.jsxs("div",{className:"activation-content",children:[w.jsxs("div",{className:"activation-logo",children:[w.jsx("h1",{className:"activation-title",children:"DRIFT"}),w.jsx("div",{className:"activation-subtitle",children:"WANDERING DELAY"})]}),w.jsxs("div",{className:"activation-state-area",children:[t==="checking"&&w.jsxs("div",{className:"activation-state-content",children:[w.jsx("div",{className:"activation-spinner"}),w.jsx("p",{children:"Checking license..."})]}),t==="input"&&w.jsxs("div",{className:"activation-state-content",children:[w.jsx("p",{className:"activation-prompt",children:"Enter your license key to activate"}),w.jsx("input",{type:"text",className:"activation-input",placeholder:"XXXX-XXXX-XXXX-XXXX",value:r,onChange:y=>l(y.target.value.toUpperCase()),onKeyDown:v,autoFocus:!0,spellCheck:!1}),w.jsx("button",{className:"activation-button",onClick:h,disabled:!r.trim(),children:"Activate"})]}),t==="activating"&&w.jsxs("div",{className:"activation-state-content",children:[w.jsx("div",{className:"activation-spinner"}),w.jsx("p",{children:"Activating..."})]}),t==="success"&&w.jsxs("div",{className:"activation-state-content",children:[w.jsx("div",{className:"activation-checkmark",children:w.jsxs("svg",{viewBox:"0 0 52 52",children:[w.jsx("circle",{className:"checkmark-circle",cx:"26",cy:"26",r:"25",fill:"none"}),w.jsx("path",{className:"checkmark-check",fill:"none",d:"M14.1 27.2l7.1 7.2 16.7-16.8"})]})}),w.jsx("p",{className:"activation-success-text",children:"Activated!"}),u&&w.jsxs("p",{className:"activation-info",children:[u.currentActivations," of ",u.maxActivations," activations used"]})]}),t==="error"&&w.jsxs("div",{className:"activation-state-content",children:[w.jsx("div",{className:"activation-error-icon",children:"!"}),w.jsx("p",{className:"activation-error-text",children:i}),w.jsx("button",{className:"activation-button secondary",onClick:S,children:"Try Again"})]})]})]}),w.jsx("div",{className:"activation-version",children:"v1.0.0"})]})}const mp=["1/1","1/2","1/4","1/8","1/16","1/32","1/4T","1/8T","1/16T","1/4D","1/8D","1/16D"];function gp(){const[e,t]=z.useState(!1);return e?w.jsx(yp,{}):w.jsx(hp,{onActivated:()=>t(!0)})}function yp(){const e=st("time",400),t=dp("sync",!1),n=ps("division",12,2),r=st("feedback",50),l=st("duck",30),i=ps("taps",4,2),o=st("spread",50),u=st("mix",50),s=st("grit",0),f=st("age",25),m=st("diffuse",0),h=vp(),v=z.useRef(null),S=z.useRef(0),y=z.useRef([0,0,0,0]),k=z.useRef(0),D=z.useRef([0,0,0,0]),d=z.useRef([]);if(d.current.length===0)for(let c=0;c<6;c++)d.current.push({x:Math.random()*2e3,y:.42+Math.random()*.38,length:150+Math.random()*350,phase:Math.random()*Math.PI*2,speed:.8+Math.random()*.5});const a=z.useRef([]);if(a.current.length===0)for(let c=0;c<20;c++)a.current.push({x:Math.random()*2e3,y:.65+Math.random()*.3,size:1+Math.random()*1.5,drift:Math.random()*Math.PI*2,speed:.3+Math.random()*.4});return z.useEffect(()=>{const c=v.current;if(!c)return;const p=c.getContext("2d");let C;const P=()=>{const E=window.devicePixelRatio||1;c.width=window.innerWidth*E,c.height=window.innerHeight*E,c.style.width=window.innerWidth+"px",c.style.height=window.innerHeight+"px",p.scale(E,E)};P(),window.addEventListener("resize",P);const N=()=>{C=requestAnimationFrame(N),S.current+=.016;const E=window.innerWidth,T=window.innerHeight,M=S.current,we=.25,Pt=.04,Tt=[h.tap1Level,h.tap2Level,h.tap3Level,h.tap4Level];for(let x=0;x<4;x++){const X=Tt[x],le=y.current[x],Be=X>le?we:Pt;y.current[x]+=(X-le)*Be}const hr=h.duckEnvelope;k.current+=(hr-k.current)*.08;const Qt=k.current,xn=i.value,je=p.createLinearGradient(0,0,0,T);je.addColorStop(0,"#0f0805"),je.addColorStop(.2,"#1a0d06"),je.addColorStop(.4,"#3a1c10"),je.addColorStop(.6,"#5a2a18"),je.addColorStop(.8,"#7a3a20"),je.addColorStop(1,"#4a2515"),p.fillStyle=je,p.fillRect(0,0,E,T);const _=p.createLinearGradient(0,T*.4,0,T*.65);_.addColorStop(0,"rgba(255, 180, 120, 0)"),_.addColorStop(.5,"rgba(255, 160, 100, 0.08)"),_.addColorStop(1,"rgba(255, 140, 80, 0)"),p.fillStyle=_,p.fillRect(0,0,E,T);const j=E*.75,R=T*.28,U=p.createRadialGradient(j,R,0,j,R,160);U.addColorStop(0,"rgba(255, 220, 160, 0.6)"),U.addColorStop(.2,"rgba(255, 190, 120, 0.35)"),U.addColorStop(.5,"rgba(255, 150, 80, 0.15)"),U.addColorStop(1,"transparent"),p.fillStyle=U,p.fillRect(0,0,E,T),p.beginPath(),p.arc(j,R,18,0,Math.PI*2);const B=p.createRadialGradient(j,R,0,j,R,18);B.addColorStop(0,"rgba(255, 240, 200, 0.9)"),B.addColorStop(.7,"rgba(255, 200, 140, 0.6)"),B.addColorStop(1,"rgba(255, 180, 120, 0)"),p.fillStyle=B,p.fill(),p.fillStyle="rgba(255, 220, 180, 0.25)";for(let x=0;x<15;x++){const X=(x*137.5+50)%E,le=(x*89.3+20)%(T*.35);p.beginPath(),p.arc(X,le,.6+x%3*.3,0,Math.PI*2),p.fill()}p.fillStyle="#2a1610",p.beginPath(),p.moveTo(0,T);for(let x=0;x<=E;x+=30){const X=Math.sin(x*.002+.5)*50+Math.sin(x*.005)*25;p.lineTo(x,T*.52+X)}p.lineTo(E,T),p.fill();const Yt=Qt*10;p.fillStyle="#3a2015",p.beginPath(),p.moveTo(0,T);for(let x=0;x<=E;x+=20){const X=Math.sin(x*.003+1+M*.02)*40+Math.sin(x*.007+Yt*.1)*20;p.lineTo(x,T*.6+X)}p.lineTo(E,T),p.fill();const Re=p.createLinearGradient(0,T*.68,0,T);Re.addColorStop(0,"#4a2818"),Re.addColorStop(1,"#2a1810"),p.fillStyle=Re,p.beginPath(),p.moveTo(0,T);for(let x=0;x<=E;x+=15){const X=Math.sin(x*.004+M*.04+Qt*.5)*35+Math.sin(x*.01)*15;p.lineTo(x,T*.7+X)}p.lineTo(E,T),p.fill();for(const x of a.current){x.x+=x.speed,x.y+=Math.sin(M*.5+x.drift)*3e-4,x.x>E+10&&(x.x=-10);const X=x.y*T,le=.15+Math.sin(M*.3+x.drift)*.05;p.beginPath(),p.arc(x.x,X,x.size,0,Math.PI*2),p.fillStyle=`rgba(255, 200, 150, ${le})`,p.fill()}for(const x of d.current){x.x+=x.speed,x.x>E+x.length&&(x.x=-x.length);const X=x.y*T,le=Math.sin(M*.3+x.phase)*6,Be=p.createLinearGradient(x.x,X,x.x+x.length,X);Be.addColorStop(0,"rgba(255, 210, 170, 0)"),Be.addColorStop(.3,"rgba(255, 210, 170, 0.06)"),Be.addColorStop(.5,"rgba(255, 200, 160, 0.09)"),Be.addColorStop(.7,"rgba(255, 210, 170, 0.06)"),Be.addColorStop(1,"rgba(255, 210, 170, 0)"),p.strokeStyle=Be,p.lineWidth=1.5,p.lineCap="round",p.beginPath(),p.moveTo(x.x,X+le),p.quadraticCurveTo(x.x+x.length*.5,X+le+Math.sin(M*.2+x.phase)*4,x.x+x.length,X+le+Math.sin(M*.25+x.phase+1)*5),p.stroke()}const Ge=T*.48+35;for(let x=0;x<4;x++){const X=x<xn,le=X?y.current[x]:0,Be=X&&le>.02?.35+le*.45:0;if(D.current[x]+=(Be-D.current[x])*.03,D.current[x]<.01)continue;const Pc=x*25,Cn=Ge+Pc,nu=.8+x*.2,Dl=28-x*6,Il=D.current[x];p.beginPath(),p.moveTo(0,Cn);for(let De=0;De<=E;De+=8){const Ol=Math.sin(De*.008-M*nu+x*.5)*(15+le*20),Fl=Math.sin(De*.003+Qt*2+M*.3)*(10*(x+1)*.5);p.lineTo(De,Cn+Ol+Fl)}for(let De=E;De>=0;De-=8){const Ol=Math.sin(De*.008-M*nu+x*.5+.3)*(12+le*15),Fl=Math.sin(De*.003+Qt*2+M*.3)*(8*(x+1)*.5);p.lineTo(De,Cn+Ol+Fl+4+le*8)}p.closePath();const gr=p.createLinearGradient(0,Cn-15,0,Cn+25);gr.addColorStop(0,`hsla(${Dl}, 55%, 65%, ${Il*.7})`),gr.addColorStop(.5,`hsla(${Dl}, 50%, 50%, ${Il*.85})`),gr.addColorStop(1,`hsla(${Dl}, 45%, 38%, ${Il*.5})`),p.fillStyle=gr,p.fill()}const ot=p.createRadialGradient(E/2,T/2,T*.35,E/2,T/2,T);ot.addColorStop(0,"transparent"),ot.addColorStop(1,"rgba(0, 0, 0, 0.45)"),p.fillStyle=ot,p.fillRect(0,0,E,T)};return N(),()=>{cancelAnimationFrame(C),window.removeEventListener("resize",P)}},[i.value,h]),w.jsxs("div",{className:"app",children:[w.jsx("canvas",{ref:v,className:"canvas"}),w.jsxs("div",{className:"header",children:[w.jsx("div",{className:"logo",children:"DRIFT"}),w.jsx("div",{className:"subtitle",children:"WANDERING DELAY"})]}),w.jsxs("div",{className:"controls-panel",children:[w.jsx(Sp,{syncEnabled:t.value,onSyncToggle:t.toggle,timeValue:e.value,onTimeChange:e.setValue,onTimeDragStart:e.dragStart,onTimeDragEnd:e.dragEnd,divisionValue:n.value,onDivisionChange:n.setChoice}),w.jsx(zt,{label:"FEEDBACK",value:r.value,onChange:r.setValue,onDragStart:r.dragStart,onDragEnd:r.dragEnd,min:0,max:100,format:c=>`${c.toFixed(0)}%`}),w.jsx(wp,{value:i.value,onChange:i.setChoice}),w.jsx(zt,{label:"SPREAD",value:o.value,onChange:o.setValue,onDragStart:o.dragStart,onDragEnd:o.dragEnd,min:0,max:100,format:c=>`${c.toFixed(0)}%`}),w.jsx("div",{className:"divider"}),w.jsx(zt,{label:"GRIT",value:s.value,onChange:s.setValue,onDragStart:s.dragStart,onDragEnd:s.dragEnd,min:0,max:100,format:c=>`${c.toFixed(0)}%`,small:!0}),w.jsx(zt,{label:"AGE",value:f.value,onChange:f.setValue,onDragStart:f.dragStart,onDragEnd:f.dragEnd,min:0,max:100,format:c=>`${c.toFixed(0)}%`,small:!0}),w.jsx(zt,{label:"DIFFUSE",value:m.value,onChange:m.setValue,onDragStart:m.dragStart,onDragEnd:m.dragEnd,min:0,max:100,format:c=>`${c.toFixed(0)}%`,small:!0}),w.jsx("div",{className:"divider"}),w.jsx(zt,{label:"DUCK",value:l.value,onChange:l.setValue,onDragStart:l.dragStart,onDragEnd:l.dragEnd,min:0,max:100,format:c=>`${c.toFixed(0)}%`}),w.jsx(zt,{label:"MIX",value:u.value,onChange:u.setValue,onDragStart:u.dragStart,onDragEnd:u.dragEnd,min:0,max:100,format:c=>`${c.toFixed(0)}%`})]})]})}function zt({label:e,value:t,onChange:n,onDragStart:r,onDragEnd:l,min:i,max:o,format:u,small:s}){const f=z.useRef(!1),m=z.useRef(0),h=z.useRef(0),v=(t-i)/(o-i),S=-135+v*270,y=z.useCallback(d=>{f.current=!0,m.current=d.clientY,h.current=t,r==null||r();const a=p=>{if(!f.current)return;const C=m.current-p.clientY,P=(o-i)/200;let N=h.current+C*P;N=Math.max(i,Math.min(o,N)),n(N)},c=()=>{f.current=!1,l==null||l(),window.removeEventListener("mousemove",a),window.removeEventListener("mouseup",c)};window.addEventListener("mousemove",a),window.addEventListener("mouseup",c)},[t,i,o,n,r,l]),k=z.useCallback(d=>{d.preventDefault();const a=(o-i)/100;let c=t-d.deltaY*a*.1;c=Math.max(i,Math.min(o,c)),n(c)},[t,i,o,n]),D=s?38:50;return w.jsxs("div",{className:`control ${s?"small":""}`,children:[w.jsx("div",{className:"control-label",children:e}),w.jsx("div",{className:"knob",style:{width:D,height:D},onMouseDown:y,onWheel:k,children:w.jsxs("svg",{viewBox:"0 0 60 60",className:"knob-svg",children:[w.jsx("circle",{cx:"30",cy:"30",r:"24",fill:"none",stroke:"rgba(200, 150, 100, 0.12)",strokeWidth:"3",strokeLinecap:"round",strokeDasharray:"113",strokeDashoffset:"28",transform:"rotate(135 30 30)"}),w.jsx("circle",{cx:"30",cy:"30",r:"24",fill:"none",stroke:"rgba(255, 180, 120, 0.75)",strokeWidth:"3",strokeLinecap:"round",strokeDasharray:`${v*113} 200`,strokeDashoffset:"0",transform:"rotate(135 30 30)"}),w.jsx("line",{x1:"30",y1:"30",x2:"30",y2:"12",stroke:"rgba(255, 200, 150, 0.9)",strokeWidth:"2",strokeLinecap:"round",transform:`rotate(${S} 30 30)`}),w.jsx("circle",{cx:"30",cy:"30",r:"3",fill:"rgba(200, 150, 100, 0.15)"})]})}),w.jsx("div",{className:"control-value",children:u(t)})]})}function wp({value:e,onChange:t}){return w.jsxs("div",{className:"control taps-control",children:[w.jsx("div",{className:"control-label",children:"TAPS"}),w.jsx("div",{className:"taps-buttons",children:[1,2,3,4].map(n=>w.jsx("button",{className:`tap-button ${e===n?"active":""}`,onClick:()=>t(n),children:n},n))})]})}function Sp({syncEnabled:e,onSyncToggle:t,timeValue:n,onTimeChange:r,onTimeDragStart:l,onTimeDragEnd:i,divisionValue:o,onDivisionChange:u}){const s=z.useRef(!1),f=z.useRef(0),m=z.useRef(0),h=10,v=2e3,S=(n-h)/(v-h),y=-135+S*270,k=z.useCallback(d=>{if(e)return;s.current=!0,f.current=d.clientY,m.current=n,l();const a=p=>{if(!s.current)return;const C=f.current-p.clientY,P=(v-h)/200;let N=m.current+C*P;N=Math.max(h,Math.min(v,N)),r(N)},c=()=>{s.current=!1,i(),window.removeEventListener("mousemove",a),window.removeEventListener("mouseup",c)};window.addEventListener("mousemove",a),window.addEventListener("mouseup",c)},[e,n,r,l,i]),D=z.useCallback(d=>{if(e)return;d.preventDefault();const a=(v-h)/100;let c=n-d.deltaY*a*.1;c=Math.max(h,Math.min(v,c)),r(c)},[e,n,r]);return w.jsxs("div",{className:"control time-control",children:[w.jsxs("div",{className:"time-header",children:[w.jsx("span",{className:"time-label",children:e?"SYNC":"TIME"}),w.jsx("button",{className:`sync-toggle ${e?"active":""}`,onClick:t,title:"Toggle tempo sync",children:w.jsxs("svg",{viewBox:"0 0 16 16",className:"sync-icon",children:[w.jsx("path",{d:"M8 3v2M8 11v2M3 8h2M11 8h2M4.5 4.5l1.4 1.4M10.1 10.1l1.4 1.4M4.5 11.5l1.4-1.4M10.1 5.9l1.4-1.4",stroke:"currentColor",strokeWidth:"1.5",strokeLinecap:"round"}),w.jsx("circle",{cx:"8",cy:"8",r:"2",fill:"currentColor"})]})})]}),e?w.jsxs("div",{className:"division-selector",children:[w.jsx("button",{className:"div-arrow",onClick:()=>u(Math.max(0,o-1)),children:"◀"}),w.jsx("span",{className:"division-value",children:mp[o]||"1/4"}),w.jsx("button",{className:"div-arrow",onClick:()=>u(Math.min(11,o+1)),children:"▶"})]}):w.jsx("div",{className:"knob",style:{width:50,height:50},onMouseDown:k,onWheel:D,children:w.jsxs("svg",{viewBox:"0 0 60 60",className:"knob-svg",children:[w.jsx("circle",{cx:"30",cy:"30",r:"24",fill:"none",stroke:"rgba(200, 150, 100, 0.12)",strokeWidth:"3",strokeLinecap:"round",strokeDasharray:"113",strokeDashoffset:"28",transform:"rotate(135 30 30)"}),w.jsx("circle",{cx:"30",cy:"30",r:"24",fill:"none",stroke:"rgba(255, 180, 120, 0.75)",strokeWidth:"3",strokeLinecap:"round",strokeDasharray:`${S*113} 200`,strokeDashoffset:"0",transform:"rotate(135 30 30)"}),w.jsx("line",{x1:"30",y1:"30",x2:"30",y2:"12",stroke:"rgba(255, 200, 150, 0.9)",strokeWidth:"2",strokeLinecap:"round",transform:`rotate(${y} 30 30)`}),w.jsx("circle",{cx:"30",cy:"30",r:"3",fill:"rgba(200, 150, 100, 0.15)"})]})}),w.jsx("div",{className:"control-value",children:e?"tempo":`${n.toFixed(0)}ms`})]})}di.createRoot(document.getElementById("root")).render(w.jsx(Kc.StrictMode,{children:w.jsx(gp,{})}));
@@ -0,0 +1,245 @@
+#include "ActivationService.h"
+#include "ActivationToken.h"
+#include "ProjectInfo.h"
+
+namespace
+{
+    // Offline grace period for the cached token
+    constexpr juce::int64 kTokenLifetimeMs = 7LL * 24 * 60 * 60 * 1000;
+
+    constexpr int kRequestTimeoutMs = 10000;
+
+    // How long closing the last instance waits for a running task. Token requests
+    // abort at once; only the SDK's own calls can take this long.
+    constexpr int kShutdownTimeoutMs = 3000;
+
+    // Issues signed validity tokens for activated devices
+    constexpr const char* kTokenEndpoint = "/activation/token";
+
+    juce::File getTokenFile()
+    {
+        return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+            .getChildFile("BeatConnect")
+            .getChildFile("DRIFT")
+            .getChildFile("activation.token");
+    }
+
+    juce::String getApiBaseUrl()
+    {
+#if DRIFT_DEV_MODE
+        // Dev builds can talk to a mock server. Release builds must not: the SDK's
+        // own validation trusts whatever server it is pointed at.
+        return juce::SystemStats::getEnvironmentVariable("DRIFT_ACTIVATION_API_URL", ProjectInfo::get().apiBaseUrl);
+#else
+        return ProjectInfo::get().apiBaseUrl;
+#endif
+    }
+
+    juce::RSAKey getPublicKey()
+    {
+#if DRIFT_DEV_MODE
+        // Dev builds can trust a mock server's key
+        const auto key = juce::SystemStats::getEnvironmentVariable("DRIFT_ACTIVATION_PUBLIC_KEY",
+                                                                   ProjectInfo::get().activationPublicKey);
+#else
+        const auto key = ProjectInfo::get().activationPublicKey;
+#endif
+        return key.isNotEmpty() ? juce::RSAKey(key) : juce::RSAKey();
+    }
+
+    bool isTokenValid(const juce::var& token)
+    {
+        if (!token.isObject())
+            return false;
+
+        const auto pluginId = token.getProperty("pluginId", "").toString();
+        const auto deviceId = token.getProperty("deviceId", "").toString();
+        const auto validatedAt = static_cast<juce::int64>(token.getProperty("validatedAt", 0));
+        const auto signature = token.getProperty("signature", "").toString();
+        const auto age = juce::Time::currentTimeMillis() - validatedAt;
+
+        return pluginId == ProjectInfo::get().pluginId
+            && deviceId == juce::SystemStats::getUniqueDeviceID()
+            && age >= 0 && age < kTokenLifetimeMs
+            && ActivationToken::verify(ActivationToken::getSignedPayload(pluginId, deviceId, validatedAt),
+                                       signature, getPublicKey());
+    }
+
+    bool readCachedToken()
+    {
+        auto file = getTokenFile();
+        return file.existsAsFile() && isTokenValid(juce::JSON::parse(file.loadFileAsString()));
+    }
+
+    void notifyListeners(juce::WeakReference<ActivationService> service)
+    {
+        juce::MessageManager::callAsync([service]
+        {
+            if (auto* s = service.get())
+                s->sendChangeMessage();
+        });
+    }
+}
+
+ActivationService::ActivationService()
+{
+    pool_.addJob([state = state_, service = juce::WeakReference<ActivationService>(this)]
+    {
+        validate(*state, service);
+    });
+}
+
+ActivationService::~ActivationService()
+{
+    state_->shouldExit.store(true, std::memory_order_release);
+
+    {
+        const juce::ScopedLock lock(state_->requestLock);
+        if (state_->request != nullptr)
+            state_->request->cancel();
+    }
+
+    // If the SDK is still busy, the pool's destructor waits briefly, then stops the thread by force
+    pool_.removeAllJobs(true, kShutdownTimeoutMs);
+}
+
+bool ActivationService::isActivated() const
+{
+#if BEATCONNECT_ACTIVATION_ENABLED
+    if (auto* activation = getActivation())
+        return activation->isActivated();
+#endif
+    return state_->cachedTokenValid.load(std::memory_order_acquire);
+}
+
+void ActivationService::validate(State& state, juce::WeakReference<ActivationService> service)
+{
+    state.cachedTokenValid.store(readCachedToken(), std::memory_order_release);
+    notifyListeners(service);
+
+#if BEATCONNECT_ACTIVATION_ENABLED
+    const auto& project = ProjectInfo::get();
+
+    if (project.enableActivation && project.pluginId.isNotEmpty() && !state.shouldExit.load(std::memory_order_acquire))
+    {
+        beatconnect::ActivationConfig config;
+        config.apiBaseUrl = getApiBaseUrl().toStdString();
+        config.pluginId = project.pluginId.toStdString();
+        config.supabaseKey = project.supabaseKey.toStdString();
+        config.validateOnStartup = true;
+        config.revalidateIntervalSeconds = 86400; // Daily revalidation
+
+        state.activation = beatconnect::Activation::create(config);
+        DBG("Activation system configured");
+
+        updateCachedToken(state);
+    }
+#endif
+
+    state.ready.store(true, std::memory_order_release);
+    notifyListeners(service);
+}
+
+void ActivationService::refreshCachedToken()
+{
+    if (isReady())
+        pool_.addJob([state = state_] { updateCachedToken(*state); });
+}
+
+#if BEATCONNECT_ACTIVATION_ENABLED
+void ActivationService::deactivate(std::function<void(beatconnect::ActivationStatus)> onComplete)
+{
+    if (! isReady())
+        return;
+
+    pool_.addJob([state = state_, onComplete = std::move(onComplete)]
+    {
+        if (state->activation == nullptr || state->shouldExit.load(std::memory_order_acquire))
+            return;
+
+        const auto status = state->activation->deactivate();
+        updateCachedToken(*state);
+
+        juce::MessageManager::callAsync([onComplete, status] { onComplete(status); });
+    });
+}
+#endif
+
+// ==============================================================================
+// Cached validity token
+// ==============================================================================
+
+void ActivationService::updateCachedToken(State& state)
+{
+#if BEATCONNECT_ACTIVATION_ENABLED
+    if (state.activation == nullptr || state.shouldExit.load(std::memory_order_acquire))
+        return;
+
+    auto info = state.activation->getActivationInfo();
+
+    if (state.activation->isActivated() && info && info->isValid)
+        fetchSignedToken(state, juce::String(info->activationCode));
+    else
+        clearCachedToken(state);
+#else
+    juce::ignoreUnused(state);
+#endif
+}
+
+void ActivationService::fetchSignedToken(State& state, const juce::String& activationCode)
+{
+    const auto& project = ProjectInfo::get();
+
+    juce::DynamicObject::Ptr request = new juce::DynamicObject();
+    request->setProperty("pluginId", project.pluginId);
+    request->setProperty("deviceId", juce::SystemStats::getUniqueDeviceID());
+    request->setProperty("activationCode", activationCode);
+
+    const auto url = juce::URL(getApiBaseUrl() + kTokenEndpoint)
+                         .withPOSTData(juce::JSON::toString(juce::var(request.get())));
+
+    juce::WebInputStream stream(url, true);
+    stream.withExtraHeaders("Content-Type: application/json\r\napikey: " + project.supabaseKey)
+          .withConnectionTimeout(kRequestTimeoutMs);
+
+    // Registered under the lock, so the destructor either sees the request and
+    // cancels it or has already set shouldExit
+    {
+        const juce::ScopedLock lock(state.requestLock);
+        if (state.shouldExit.load(std::memory_order_acquire))
+            return;
+        state.request = &stream;
+    }
+
+    // On failure the existing token stays until it expires or the next validation
+    const bool connected = stream.connect(nullptr) && stream.getStatusCode() == 200;
+    const auto response = connected ? stream.readEntireStreamAsString() : juce::String();
+
+    {
+        const juce::ScopedLock lock(state.requestLock);
+        state.request = nullptr;
+    }
+
+    if (! connected || state.shouldExit.load(std::memory_order_acquire))
+        return;
+
+    const auto token = juce::JSON::parse(response);
+
+    if (state.shouldExit.load(std::memory_order_acquire) || !isTokenValid(token))
+    {
+        DBG("Activation server returned no valid token");
+        return;
+    }
+
+    state.cachedTokenValid.store(true, std::memory_order_release);
+
+    auto file = getTokenFile();
+    file.getParentDirectory().createDirectory();
+    file.replaceWithText(response);
+}
+
+void ActivationService::clearCachedToken(State& state)
+{
+    state.cachedTokenValid.store(false, std::memory_order_release);
+    getTokenFile().deleteFile();
+}
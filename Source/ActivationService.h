@@ -0,0 +1,80 @@
+#pragma once
+
+#include <juce_events/juce_events.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#if BEATCONNECT_ACTIVATION_ENABLED
+#include <beatconnect/Activation.h>
+#endif
+
+// Process-wide BeatConnect activation, shared by every DRIFT instance through
+// juce::SharedResourcePointer.
+//
+// Constructing the service does no I/O. A background task reads the cached
+// validity token, creates and validates the SDK's Activation once for the whole
+// process, then fetches a freshly signed token from the activation server. Until
+// validation finishes, isActivated() answers from the token. Listeners get a
+// change message once the service is ready.
+//
+// Background work runs on the service's own thread pool, so no thread is left
+// running plugin code once the host unloads it. Destroying the service (when the
+// last instance closes) aborts any token request in flight and waits a bounded
+// time for the running task.
+//
+// In DRIFT_DEV_MODE builds, set DRIFT_ACTIVATION_API_URL to point validation at a
+// local mock server (see Tools/DriftMockActivationServer.cpp).
+class ActivationService : public juce::ChangeBroadcaster
+{
+public:
+    ActivationService();
+    ~ActivationService() override;
+
+    // True once the background validation has finished
+    bool isReady() const noexcept { return state_->ready.load(std::memory_order_acquire); }
+
+    // Validated state once ready, the cached token before that
+    bool isActivated() const;
+
+#if BEATCONNECT_ACTIVATION_ENABLED
+    // nullptr until the service is ready
+    beatconnect::Activation* getActivation() const noexcept { return isReady() ? state_->activation.get() : nullptr; }
+
+    // Deactivates this device on the service's thread and updates the cached token.
+    // onComplete is called on the message thread, unless the service is destroyed first.
+    void deactivate(std::function<void(beatconnect::ActivationStatus)> onComplete);
+#endif
+
+    // Replaces the cached token to match the current activation state. Call after
+    // activating; a new signed token is fetched in the background.
+    void refreshCachedToken();
+
+private:
+    // Everything the background tasks touch
+    struct State
+    {
+        std::atomic<bool> ready{ false };
+        std::atomic<bool> cachedTokenValid{ false };
+        std::atomic<bool> shouldExit{ false };
+
+        // The token request in flight, so the destructor can abort it
+        juce::CriticalSection requestLock;
+        juce::WebInputStream* request = nullptr;
+
+#if BEATCONNECT_ACTIVATION_ENABLED
+        std::unique_ptr<beatconnect::Activation> activation;
+#endif
+    };
+
+    static void validate(State& state, juce::WeakReference<ActivationService> service);
+    static void updateCachedToken(State& state);
+    static void fetchSignedToken(State& state, const juce::String& activationCode);
+    static void clearCachedToken(State& state);
+
+    std::shared_ptr<State> state_ = std::make_shared<State>();
+    juce::ThreadPool pool_{ juce::ThreadPoolOptions{}.withThreadName("DRIFT Activation").withNumberOfThreads(1) };
+
+    JUCE_DECLARE_WEAK_REFERENCEABLE(ActivationService)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ActivationService)
+};
@@ -0,0 +1,39 @@
+#include "ActivationToken.h"
+
+namespace
+{
+    juce::BigInteger getDigest(const juce::String& payload)
+    {
+        juce::BigInteger digest;
+        digest.parseString(juce::SHA256(payload.toUTF8()).toHexString(), 16);
+        return digest;
+    }
+}
+
+namespace ActivationToken
+{
+    juce::String getSignedPayload(const juce::String& pluginId, const juce::String& deviceId, juce::int64 validatedAt)
+    {
+        return pluginId + "|" + deviceId + "|" + juce::String(validatedAt);
+    }
+
+    juce::String sign(const juce::String& payload, const juce::RSAKey& privateKey)
+    {
+        auto value = getDigest(payload);
+        if (!privateKey.applyToValue(value))
+            return {};
+
+        return value.toString(16);
+    }
+
+    bool verify(const juce::String& payload, const juce::String& signature, const juce::RSAKey& publicKey)
+    {
+        if (signature.isEmpty() || !signature.containsOnly("0123456789abcdefABCDEF"))
+            return false;
+
+        juce::BigInteger value;
+        value.parseString(signature, 16);
+
+        return publicKey.applyToValue(value) && value == getDigest(payload);
+    }
+}
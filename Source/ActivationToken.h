@@ -0,0 +1,18 @@
+#pragma once
+
+#include <juce_cryptography/juce_cryptography.h>
+
+// The cached validity token lets DRIFT start activated while offline. The
+// activation server signs it with its private key and DRIFT only embeds the public
+// key (project data), so a token can't be made or extended from the fields it
+// carries. Keys must be wider than the 256-bit digest; the mock server uses 2048.
+namespace ActivationToken
+{
+    // The text covered by the signature
+    juce::String getSignedPayload(const juce::String& pluginId, const juce::String& deviceId, juce::int64 validatedAt);
+
+    // Hex signature of the payload's SHA-256 digest. Server side (and the mock server).
+    juce::String sign(const juce::String& payload, const juce::RSAKey& privateKey);
+
+    bool verify(const juce::String& payload, const juce::String& signature, const juce::RSAKey& publicKey);
+}
@@ -0,0 +1,145 @@
+#include "DspKernels.h"
+#include <juce_core/juce_core.h>
+#include <atomic>
+
+// Baseline variant: built with the target's default flags (SSE2 on x86-64, NEON on arm64)
+#include "DspKernelsImpl.h"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+ #define DRIFT_BASELINE_ISA      DriftKernels::Isa::NEON
+ #define DRIFT_BASELINE_ISA_NAME "neon"
+#elif defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+ #define DRIFT_BASELINE_ISA      DriftKernels::Isa::SSE2
+ #define DRIFT_BASELINE_ISA_NAME "sse2"
+#else
+ #define DRIFT_BASELINE_ISA      DriftKernels::Isa::Generic
+ #define DRIFT_BASELINE_ISA_NAME "generic"
+#endif
+
+#ifndef DRIFT_HAS_AVX2_KERNELS
+ #define DRIFT_HAS_AVX2_KERNELS 0
+#endif
+
+#ifndef DRIFT_HAS_AVX512_KERNELS
+ #define DRIFT_HAS_AVX512_KERNELS 0
+#endif
+
+namespace DriftKernels
+{
+    namespace
+    {
+        const KernelTable baselineKernels = DRIFT_KERNEL_TABLE(DRIFT_BASELINE_ISA, DRIFT_BASELINE_ISA_NAME);
+
+        std::atomic<const KernelTable*> selectedKernels{ nullptr };
+
+        const KernelTable* findKernels(Isa isa)
+        {
+            if (isa == baselineKernels.isa)
+                return &baselineKernels;
+
+            if (isa == Isa::Generic)
+                return &getGenericKernels();
+
+#if DRIFT_HAS_AVX2_KERNELS
+            if (isa == Isa::AVX2)
+                return &getAvx2Kernels();
+#endif
+#if DRIFT_HAS_AVX512_KERNELS
+            if (isa == Isa::AVX512)
+                return &getAvx512Kernels();
+#endif
+            return nullptr;
+        }
+
+        bool cpuSupports(Isa isa)
+        {
+            switch (isa)
+            {
+                case Isa::Generic: return true;
+                case Isa::SSE2:    return juce::SystemStats::hasSSE2();
+                case Isa::AVX2:    return juce::SystemStats::hasAVX2() && juce::SystemStats::hasFMA3();
+                case Isa::AVX512:  return juce::SystemStats::hasAVX512F() && juce::SystemStats::hasAVX512VL()
+                                       && juce::SystemStats::hasAVX512BW() && juce::SystemStats::hasAVX512DQ()
+                                       && juce::SystemStats::hasFMA3();
+                case Isa::NEON:    return juce::SystemStats::hasNeon();
+            }
+            return false;
+        }
+
+        bool parseIsa(const juce::String& name, Isa& isa)
+        {
+            for (auto candidate : { Isa::Generic, Isa::SSE2, Isa::AVX2, Isa::AVX512, Isa::NEON })
+            {
+                if (name.equalsIgnoreCase(getIsaName(candidate)))
+                {
+                    isa = candidate;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        const KernelTable* initialKernels()
+        {
+            auto forced = juce::SystemStats::getEnvironmentVariable("DRIFT_FORCE_ISA", {}).trim();
+            if (forced.isNotEmpty())
+            {
+                Isa isa;
+                if (parseIsa(forced, isa) && isSupported(isa))
+                    return findKernels(isa);
+
+                DBG("DRIFT_FORCE_ISA=" + forced + " is not supported here, using auto-detection");
+            }
+
+            return findKernels(detectBestIsa());
+        }
+    }
+
+    const KernelTable& get()
+    {
+        auto* kernels = selectedKernels.load(std::memory_order_acquire);
+        if (kernels == nullptr)
+        {
+            kernels = initialKernels();
+            selectedKernels.store(kernels, std::memory_order_release);
+            DBG("DSP kernels: " + juce::String(kernels->name));
+        }
+        return *kernels;
+    }
+
+    bool select(Isa isa)
+    {
+        if (!isSupported(isa))
+            return false;
+
+        selectedKernels.store(findKernels(isa), std::memory_order_release);
+        return true;
+    }
+
+    Isa detectBestIsa()
+    {
+        for (auto isa : { Isa::AVX512, Isa::AVX2, Isa::NEON, Isa::SSE2 })
+            if (isSupported(isa))
+                return isa;
+
+        return Isa::Generic;
+    }
+
+    bool isSupported(Isa isa)
+    {
+        return findKernels(isa) != nullptr && cpuSupports(isa);
+    }
+
+    const char* getIsaName(Isa isa)
+    {
+        switch (isa)
+        {
+            case Isa::Generic: return "generic";
+            case Isa::SSE2:    return "sse2";
+            case Isa::AVX2:    return "avx2";
+            case Isa::AVX512:  return "avx512";
+            case Isa::NEON:    return "neon";
+        }
+        return "unknown";
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+// Hot DSP kernels, compiled once per instruction set and selected at load time.
+//
+// The kernel bodies live in DspKernelsImpl.h and are built into one translation
+// unit per ISA (see CMakeLists.txt). The best variant the CPU supports is picked
+// the first time get() is called. Set DRIFT_FORCE_ISA=sse2|avx2|avx512|neon|generic
+// in the environment, or call select(), to force a specific variant for testing;
+// generic is plain scalar code, never picked automatically on SSE2 or NEON targets.
+
+namespace DriftKernels
+{
+    enum class Isa
+    {
+        Generic,
+        SSE2,
+        AVX2,
+        AVX512,
+        NEON
+    };
+
+    struct KernelTable
+    {
+        Isa isa;
+        const char* name;
+
+        // Linear-interpolated reads from a circular buffer. readPos holds absolute
+        // positions in [0, bufferSize].
+        void (*readInterp)(const float* buffer, int bufferSize, const float* readPos,
+                           float* out, int numSamples);
+
+        // Soft saturation with a per-sample amount (0-1). Amounts below 0.001 pass through.
+        void (*saturate)(float* samples, const float* amount, int numSamples);
+
+        // Schroeder allpass over a circular buffer, in place. numSamples must not
+        // exceed delayLength so the block never reads its own writes.
+        void (*allpass)(float* samples, const float* coeff, int numSamples,
+                        float* ring, int ringSize, int writePos, int delayLength);
+
+        // dest[i] += src[i] * gain[i]
+        void (*mulAdd)(float* dest, const float* src, const float* gain, int numSamples);
+
+        // ring[writePos + i] = input[i] + feedback[i] * amount[i], wrapping at ringSize
+        void (*writeFeedback)(float* ring, int ringSize, int writePos, const float* input,
+                              const float* feedback, const float* amount, int numSamples);
+
+        // out[i] = dry[i] * (1 - mix[i]) + wet[i] * mix[i]. out may alias dry.
+        void (*mix)(const float* dry, const float* wet, const float* mix, float* out, int numSamples);
+    };
+
+    // Currently selected kernels (detects the CPU on first use)
+    const KernelTable& get();
+
+    // Forces a variant. Returns false and leaves the selection unchanged if this
+    // binary or CPU does not support it.
+    bool select(Isa isa);
+
+    // Best variant supported by both this binary and the running CPU
+    Isa detectBestIsa();
+
+    bool isSupported(Isa isa);
+    const char* getIsaName(Isa isa);
+
+    // Per-ISA tables built with their own target flags (DspKernels_AVX2.cpp,
+    // DspKernels_AVX512.cpp). Only linked into x86-64 builds; go through get().
+    const KernelTable& getAvx2Kernels();
+    const KernelTable& getAvx512Kernels();
+
+    // Unvectorised table (DspKernels_Generic.cpp), built on every target
+    const KernelTable& getGenericKernels();
+}
@@ -0,0 +1,123 @@
+// Kernel bodies shared by every ISA variant. Do not include directly: each
+// DspKernels*.cpp includes this once and is compiled with its ISA's flags, so the
+// compiler vectorises the same loops for SSE2, AVX2, AVX-512 or NEON.
+//
+// Everything here must have internal linkage and avoid inline library functions
+// (std::min, std::abs, ...). Otherwise the linker may merge an AVX-compiled copy
+// into the baseline path and crash older CPUs. __restrict lets the compiler use
+// vector gathers without runtime alias checks.
+
+// Placed before each kernel loop. DspKernels_Generic.cpp defines it to keep the
+// compiler from vectorising them.
+#ifndef DRIFT_KERNEL_LOOP
+ #define DRIFT_KERNEL_LOOP
+#endif
+
+namespace
+{
+    inline int wrapIndex(int index, int size)
+    {
+        return index >= size ? index - size : index;
+    }
+
+    inline int minInt(int a, int b)
+    {
+        return a < b ? a : b;
+    }
+
+    void readInterp(const float* __restrict buffer, int bufferSize, const float* __restrict readPos,
+                    float* __restrict out, int numSamples)
+    {
+        DRIFT_KERNEL_LOOP
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float pos = readPos[i];
+            const int whole = static_cast<int>(pos);
+            const int idx0 = wrapIndex(whole, bufferSize);
+            const int idx1 = wrapIndex(idx0 + 1, bufferSize);
+            const float frac = pos - static_cast<float>(whole);
+
+            out[i] = buffer[idx0] * (1.0f - frac) + buffer[idx1] * frac;
+        }
+    }
+
+    void saturate(float* __restrict samples, const float* __restrict amount, int numSamples)
+    {
+        DRIFT_KERNEL_LOOP
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float input = samples[i];
+            const float a = amount[i];
+            const float x = input * (1.0f + a * 4.0f);
+            const float absX = x < 0.0f ? -x : x;
+            const float saturated = x / (1.0f + absX);
+            const float shaped = input * (1.0f - a) + saturated * a;
+
+            samples[i] = a < 0.001f ? input : shaped;
+        }
+    }
+
+    void allpass(float* samples, const float* coeff, int numSamples,
+                 float* ring, int ringSize, int writePos, int delayLength)
+    {
+        int done = 0;
+        while (done < numSamples)
+        {
+            const int readPos = (writePos - delayLength + ringSize) % ringSize;
+            const int len = minInt(numSamples - done, minInt(ringSize - writePos, ringSize - readPos));
+
+            // Read and write ranges are delayLength apart, so they never overlap
+            const float* delayedIn = ring + readPos;
+            float* delayedOut = ring + writePos;
+            float* io = samples + done;
+            const float* c = coeff + done;
+
+            DRIFT_KERNEL_LOOP
+            for (int i = 0; i < len; ++i)
+            {
+                const float input = io[i];
+                const float output = delayedIn[i] - c[i] * input;
+                delayedOut[i] = input + c[i] * output;
+                io[i] = output;
+            }
+
+            done += len;
+            writePos = wrapIndex(writePos + len, ringSize);
+        }
+    }
+
+    void mulAdd(float* __restrict dest, const float* __restrict src, const float* __restrict gain, int numSamples)
+    {
+        DRIFT_KERNEL_LOOP
+        for (int i = 0; i < numSamples; ++i)
+            dest[i] += src[i] * gain[i];
+    }
+
+    void writeFeedback(float* __restrict ring, int ringSize, int writePos, const float* __restrict input,
+                       const float* __restrict feedback, const float* __restrict amount, int numSamples)
+    {
+        int done = 0;
+        while (done < numSamples)
+        {
+            const int len = minInt(numSamples - done, ringSize - writePos);
+            float* dest = ring + writePos;
+
+            DRIFT_KERNEL_LOOP
+            for (int i = 0; i < len; ++i)
+                dest[i] = input[done + i] + feedback[done + i] * amount[done + i];
+
+            done += len;
+            writePos = wrapIndex(writePos + len, ringSize);
+        }
+    }
+
+    void mix(const float* dry, const float* wet, const float* mixAmount, float* out, int numSamples)
+    {
+        DRIFT_KERNEL_LOOP
+        for (int i = 0; i < numSamples; ++i)
+            out[i] = dry[i] * (1.0f - mixAmount[i]) + wet[i] * mixAmount[i];
+    }
+}
+
+#define DRIFT_KERNEL_TABLE(isaValue, isaName) \
+    DriftKernels::KernelTable{ isaValue, isaName, readInterp, saturate, allpass, mulAdd, writeFeedback, mix }
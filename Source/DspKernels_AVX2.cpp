@@ -0,0 +1,12 @@
+// AVX2/FMA kernels. Compiled with -mavx2 -mfma (/arch:AVX2 on MSVC) on x86-64 only.
+#include "DspKernels.h"
+#include "DspKernelsImpl.h"
+
+namespace DriftKernels
+{
+    const KernelTable& getAvx2Kernels()
+    {
+        static const KernelTable kernels = DRIFT_KERNEL_TABLE(Isa::AVX2, "avx2");
+        return kernels;
+    }
+}
@@ -0,0 +1,12 @@
+// AVX-512 kernels. Compiled with -mavx512f/vl/bw/dq (/arch:AVX512 on MSVC) on x86-64 only.
+#include "DspKernels.h"
+#include "DspKernelsImpl.h"
+
+namespace DriftKernels
+{
+    const KernelTable& getAvx512Kernels()
+    {
+        static const KernelTable kernels = DRIFT_KERNEL_TABLE(Isa::AVX512, "avx512");
+        return kernels;
+    }
+}
@@ -0,0 +1,21 @@
+// Scalar kernels for DRIFT_FORCE_ISA=generic: the same bodies with vectorisation
+// turned off, as a reference to check the SIMD variants against.
+#if defined(__clang__)
+ #define DRIFT_KERNEL_LOOP _Pragma("clang loop vectorize(disable) interleave(disable)")
+#elif defined(_MSC_VER)
+ #define DRIFT_KERNEL_LOOP __pragma(loop(no_vector))
+#elif defined(__GNUC__)
+ #pragma GCC optimize("no-tree-vectorize")
+#endif
+
+#include "DspKernels.h"
+#include "DspKernelsImpl.h"
+
+namespace DriftKernels
+{
+    const KernelTable& getGenericKernels()
+    {
+        static const KernelTable kernels = DRIFT_KERNEL_TABLE(Isa::Generic, "generic");
+        return kernels;
+    }
+}
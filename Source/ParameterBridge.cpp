@@ -0,0 +1,199 @@
+#include "ParameterBridge.h"
+#include <cmath>
+
+ParameterBridge::ParameterBridge(juce::AudioProcessorValueTreeState& apvts)
+{
+    for (int i = 0; i < kNumParameters; ++i)
+    {
+        parameters_[static_cast<size_t>(i)] = apvts.getParameter(ParameterIDs::all[static_cast<size_t>(i)]);
+        parameters_[static_cast<size_t>(i)]->addListener(this);
+    }
+
+    lastUiValue_.fill(std::nanf(""));
+
+    for (int i = 0; i < kNumParameters; ++i)
+        lastSentValue_[static_cast<size_t>(i)] = getScaledValue(i);
+}
+
+ParameterBridge::~ParameterBridge()
+{
+    // Never leave a host gesture open when the editor closes mid-drag
+    for (int i = 0; i < kNumParameters; ++i)
+    {
+        auto* param = parameters_[static_cast<size_t>(i)];
+        param->removeListener(this);
+
+        if (uiGesture_[static_cast<size_t>(i)])
+            param->endChangeGesture();
+    }
+}
+
+juce::WebBrowserComponent::Options ParameterBridge::buildOptions(const juce::WebBrowserComponent::Options& initialOptions)
+{
+    return initialOptions
+        .withEventListener("parameterChanges", [this](const juce::var& payload) {
+            handleChanges(payload);
+        })
+        .withEventListener("requestParameterState", [this](const juce::var&) {
+            sendState();
+        });
+}
+
+void ParameterBridge::parameterValueChanged(int parameterIndex, float)
+{
+    // Any thread, including the audio thread: just mark the parameter dirty
+    for (int i = 0; i < kNumParameters; ++i)
+    {
+        if (parameters_[static_cast<size_t>(i)]->getParameterIndex() == parameterIndex)
+        {
+            dirty_.fetch_or(1u << i, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+void ParameterBridge::flush()
+{
+    // Hidden WebViews drop events, so keep changes pending until it is showing
+    if (webView_ == nullptr || ! webView_->isShowing())
+        return;
+
+    auto dirty = dirty_.exchange(0, std::memory_order_relaxed);
+
+    for (int i = 0; i < kNumParameters; ++i)
+        if (getScaledValue(i) != lastSentValue_[static_cast<size_t>(i)])
+            dirty |= 1u << i;
+
+    if (dirty == 0)
+        return;
+
+    juce::DynamicObject::Ptr values = new juce::DynamicObject();
+
+    for (int i = 0; i < kNumParameters; ++i)
+    {
+        if ((dirty & (1u << i)) == 0)
+            continue;
+
+        const auto index = static_cast<size_t>(i);
+        const float value = getScaledValue(i);
+
+        // Skip echoes of what the UI is dragging or has just sent
+        if (uiGesture_[index])
+            continue;
+
+        lastSentValue_[index] = value;
+        if (value == lastUiValue_[index])
+            continue;
+
+        lastUiValue_[index] = std::nanf("");
+        values->setProperty(ParameterIDs::all[index], value);
+    }
+
+    if (values->getProperties().isEmpty())
+        return;
+
+    juce::DynamicObject::Ptr update = new juce::DynamicObject();
+    update->setProperty("values", juce::var(values.get()));
+    webView_->emitEventIfBrowserIsVisible("parameterUpdate", juce::var(update.get()));
+}
+
+void ParameterBridge::handleChanges(const juce::var& payload)
+{
+    const auto* changes = payload.getProperty("changes", {}).getArray();
+    if (changes == nullptr)
+        return;
+
+    // Applied in order so gesture begin/end bracket their values as the UI sent them
+    for (const auto& change : *changes)
+    {
+        const int index = findParameter(change.getProperty("id", {}).toString());
+        if (index < 0)
+            continue;
+
+        const auto slot = static_cast<size_t>(index);
+        auto* param = parameters_[slot];
+        const auto type = change.getProperty("type", {}).toString();
+
+        if (type == "begin")
+        {
+            if (! uiGesture_[slot])
+                param->beginChangeGesture();
+            uiGesture_[slot] = true;
+        }
+        else if (type == "end")
+        {
+            if (uiGesture_[slot])
+                param->endChangeGesture();
+            uiGesture_[slot] = false;
+
+            // Host changes during the drag were held back, resync once it ends
+            dirty_.fetch_or(1u << index, std::memory_order_relaxed);
+        }
+        else if (type == "value")
+        {
+            const float value = static_cast<float>(change.getProperty("value", 0.0));
+            const float normalised = param->convertTo0to1(value);
+            lastUiValue_[slot] = param->convertFrom0to1(normalised);
+
+            // A lone edit (click, toggle, choice) still needs a gesture for the host
+            const bool lone = ! uiGesture_[slot];
+            if (lone)
+                param->beginChangeGesture();
+
+            param->setValueNotifyingHost(normalised);
+
+            if (lone)
+                param->endChangeGesture();
+        }
+    }
+}
+
+void ParameterBridge::sendState()
+{
+    if (webView_ == nullptr)
+        return;
+
+    juce::DynamicObject::Ptr parameters = new juce::DynamicObject();
+    for (int i = 0; i < kNumParameters; ++i)
+    {
+        parameters->setProperty(ParameterIDs::all[static_cast<size_t>(i)], getProperties(i));
+        lastSentValue_[static_cast<size_t>(i)] = getScaledValue(i);
+    }
+
+    juce::DynamicObject::Ptr state = new juce::DynamicObject();
+    state->setProperty("parameters", juce::var(parameters.get()));
+    webView_->emitEventIfBrowserIsVisible("parameterState", juce::var(state.get()));
+}
+
+int ParameterBridge::findParameter(const juce::String& id) const
+{
+    for (int i = 0; i < kNumParameters; ++i)
+        if (id == ParameterIDs::all[static_cast<size_t>(i)])
+            return i;
+    return -1;
+}
+
+juce::var ParameterBridge::getProperties(int index) const
+{
+    const auto* param = parameters_[static_cast<size_t>(index)];
+    const auto& range = param->getNormalisableRange();
+
+    juce::DynamicObject::Ptr props = new juce::DynamicObject();
+    props->setProperty("value", getScaledValue(index));
+    props->setProperty("start", range.start);
+    props->setProperty("end", range.end);
+    props->setProperty("skew", range.skew);
+    props->setProperty("interval", range.interval);
+    props->setProperty("name", param->getName(100));
+    props->setProperty("label", param->getLabel());
+    props->setProperty("numSteps", param->getNumSteps());
+    props->setProperty("parameterIndex", param->getParameterIndex());
+    props->setProperty("isToggle", param->isBoolean());
+    return juce::var(props.get());
+}
+
+float ParameterBridge::getScaledValue(int index) const
+{
+    const auto* param = parameters_[static_cast<size_t>(index)];
+    return param->convertFrom0to1(param->getValue());
+}
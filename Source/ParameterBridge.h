@@ -0,0 +1,61 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_gui_extra/juce_gui_extra.h>
+#include <array>
+#include <atomic>
+#include "ParameterIDs.h"
+
+// One bridge between every APVTS parameter and the WebView, replacing a
+// WebSliderRelay/WebToggleButtonRelay + attachment pair per parameter.
+//
+// Parameter changes from any thread (host automation arrives on the audio thread)
+// only set a bit in a lock-free dirty mask. The editor calls flush() once per UI
+// frame, which sends every changed value in a single "parameterUpdate" event, so
+// message-thread and JS work no longer scale with the automation rate. Values the
+// audio thread sets without notifying listeners (sample-accurate CLAP events) are
+// picked up in flush() by comparing against what was last sent.
+//
+// The UI sends its own edits the same way, batched per animation frame as an
+// ordered list of gesture begin / value / gesture end operations in a
+// "parameterChanges" event. Values the UI is dragging, or has just set, are not
+// echoed back to it.
+class ParameterBridge : public juce::OptionsBuilder<juce::WebBrowserComponent::Options>,
+                        private juce::AudioProcessorParameter::Listener
+{
+public:
+    explicit ParameterBridge(juce::AudioProcessorValueTreeState& apvts);
+    ~ParameterBridge() override;
+
+    // Registers the bridge's WebView event listeners (use with withOptionsFrom)
+    juce::WebBrowserComponent::Options buildOptions(const juce::WebBrowserComponent::Options& initialOptions) override;
+
+    // Message thread
+    void setWebView(juce::WebBrowserComponent* webView) { webView_ = webView; }
+    void flush();
+
+private:
+    static constexpr int kNumParameters = ParameterIDs::numParameters;
+    static_assert(kNumParameters <= 32, "Dirty mask holds one bit per parameter");
+
+    void parameterValueChanged(int parameterIndex, float newValue) override;
+    void parameterGestureChanged(int, bool) override {}
+
+    void handleChanges(const juce::var& payload);
+    void sendState();
+    int findParameter(const juce::String& id) const;
+    juce::var getProperties(int index) const;
+    float getScaledValue(int index) const;
+
+    std::array<juce::RangedAudioParameter*, kNumParameters> parameters_{};
+    std::atomic<juce::uint32> dirty_{ 0 };
+
+    // Message thread state for echo suppression and gesture bookkeeping
+    std::array<bool, kNumParameters> uiGesture_{};
+    std::array<float, kNumParameters> lastUiValue_{};
+    std::array<float, kNumParameters> lastSentValue_{};
+
+    juce::WebBrowserComponent* webView_ = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterBridge)
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 namespace ParameterIDs
 {
     // DRIFT - Wandering Delay
@@ -16,4 +18,25 @@ namespace ParameterIDs
     inline constexpr const char* grit     = "grit";     // 0 to 100% - saturation in feedback
     inline constexpr const char* age      = "age";      // 0 to 100% - per-repeat HF rolloff
     inline constexpr const char* diffuse  = "diffuse";  // 0 to 100% - allpass diffusion
+
+    // Parameter order for the tables that walk every parameter (processor, CLAP events)
+    enum Index
+    {
+        timeIndex,
+        syncIndex,
+        divisionIndex,
+        feedbackIndex,
+        duckIndex,
+        tapsIndex,
+        spreadIndex,
+        mixIndex,
+        gritIndex,
+        ageIndex,
+        diffuseIndex,
+        numParameters
+    };
+
+    inline constexpr std::array<const char*, numParameters> all = {
+        time, sync, division, feedback, duck, taps, spread, mix, grit, age, diffuse
+    };
 }
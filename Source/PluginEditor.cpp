@@ -1,52 +1,36 @@
 #include "PluginEditor.h"
-#include "ParameterIDs.h"
-#include <thread>
 
 DriftEditor::DriftEditor(DriftProcessor& p)
     : AudioProcessorEditor(&p), processor_(p)
 {
     setupWebView();
-    setupAttachments();
 
     setSize(900, 600);
     setResizable(false, false);
 
+    // Re-send activation state once the shared background validation finishes
+    if (auto* service = processor_.getActivationService())
+        service->addChangeListener(this);
+
     startTimerHz(30);
 }
 
 DriftEditor::~DriftEditor()
 {
     stopTimer();
+    processor_.getSpectrumAnalyzer().setEnabled(false);
 
-    timeAttachment_.reset();
-    syncAttachment_.reset();
-    divisionAttachment_.reset();
-    feedbackAttachment_.reset();
-    duckAttachment_.reset();
-    tapsAttachment_.reset();
-    spreadAttachment_.reset();
-    mixAttachment_.reset();
-    gritAttachment_.reset();
-    ageAttachment_.reset();
-    diffuseAttachment_.reset();
+    if (auto* service = processor_.getActivationService())
+        service->removeChangeListener(this);
 
     webView_.reset();
+    parameterBridge_.reset();
 }
 
 void DriftEditor::setupWebView()
 {
-    // Create relays BEFORE WebBrowserComponent
-    timeRelay_ = std::make_unique<juce::WebSliderRelay>(ParameterIDs::time);
-    syncRelay_ = std::make_unique<juce::WebToggleButtonRelay>(ParameterIDs::sync);
-    divisionRelay_ = std::make_unique<juce::WebSliderRelay>(ParameterIDs::division);
-    feedbackRelay_ = std::make_unique<juce::WebSliderRelay>(ParameterIDs::feedback);
-    duckRelay_ = std::make_unique<juce::WebSliderRelay>(ParameterIDs::duck);
-    tapsRelay_ = std::make_unique<juce::WebSliderRelay>(ParameterIDs::taps);
-    spreadRelay_ = std::make_unique<juce::WebSliderRelay>(ParameterIDs::spread);
-    mixRelay_ = std::make_unique<juce::WebSliderRelay>(ParameterIDs::mix);
-    gritRelay_ = std::make_unique<juce::WebSliderRelay>(ParameterIDs::grit);
-    ageRelay_ = std::make_unique<juce::WebSliderRelay>(ParameterIDs::age);
-    diffuseRelay_ = std::make_unique<juce::WebSliderRelay>(ParameterIDs::diffuse);
+    // Create the parameter bridge BEFORE WebBrowserComponent
+    parameterBridge_ = std::make_unique<ParameterBridge>(processor_.getAPVTS());
 
     auto executableFile = juce::File::getSpecialLocation(juce::File::currentExecutableFile);
     auto executableDir = executableFile.getParentDirectory();
@@ -91,17 +75,7 @@ void DriftEditor::setupWebView()
                     mimeType.toStdString()
                 };
             })
-        .withOptionsFrom(*timeRelay_)
-        .withOptionsFrom(*syncRelay_)
-        .withOptionsFrom(*divisionRelay_)
-        .withOptionsFrom(*feedbackRelay_)
-        .withOptionsFrom(*duckRelay_)
-        .withOptionsFrom(*tapsRelay_)
-        .withOptionsFrom(*spreadRelay_)
-        .withOptionsFrom(*mixRelay_)
-        .withOptionsFrom(*gritRelay_)
-        .withOptionsFrom(*ageRelay_)
-        .withOptionsFrom(*diffuseRelay_)
+        .withOptionsFrom(*parameterBridge_)
         .withEventListener("activateLicense", [this](const juce::var& data) {
             handleActivateLicense(data);
         })
@@ -120,6 +94,7 @@ void DriftEditor::setupWebView()
                         .getChildFile("DriftWebView2")));
 
     webView_ = std::make_unique<juce::WebBrowserComponent>(options);
+    parameterBridge_->setWebView(webView_.get());
     addAndMakeVisible(*webView_);
 
 #if DRIFT_DEV_MODE
@@ -129,36 +104,11 @@ void DriftEditor::setupWebView()
 #endif
 }
 
-void DriftEditor::setupAttachments()
-{
-    auto& apvts = processor_.getAPVTS();
-
-    timeAttachment_ = std::make_unique<juce::WebSliderParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::time), *timeRelay_, nullptr);
-    syncAttachment_ = std::make_unique<juce::WebToggleButtonParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::sync), *syncRelay_, nullptr);
-    divisionAttachment_ = std::make_unique<juce::WebSliderParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::division), *divisionRelay_, nullptr);
-    feedbackAttachment_ = std::make_unique<juce::WebSliderParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::feedback), *feedbackRelay_, nullptr);
-    duckAttachment_ = std::make_unique<juce::WebSliderParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::duck), *duckRelay_, nullptr);
-    tapsAttachment_ = std::make_unique<juce::WebSliderParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::taps), *tapsRelay_, nullptr);
-    spreadAttachment_ = std::make_unique<juce::WebSliderParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::spread), *spreadRelay_, nullptr);
-    mixAttachment_ = std::make_unique<juce::WebSliderParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::mix), *mixRelay_, nullptr);
-    gritAttachment_ = std::make_unique<juce::WebSliderParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::grit), *gritRelay_, nullptr);
-    ageAttachment_ = std::make_unique<juce::WebSliderParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::age), *ageRelay_, nullptr);
-    diffuseAttachment_ = std::make_unique<juce::WebSliderParameterAttachment>(
-        *apvts.getParameter(ParameterIDs::diffuse), *diffuseRelay_, nullptr);
-}
-
 void DriftEditor::timerCallback()
 {
+    // One batched parameter update per frame, however fast the host automates
+    parameterBridge_->flush();
+
     juce::DynamicObject::Ptr data = new juce::DynamicObject();
     data->setProperty("inputLevel", processor_.inputLevel.load());
     data->setProperty("duckEnvelope", processor_.duckEnvelope.load());
@@ -166,8 +116,46 @@ void DriftEditor::timerCallback()
     data->setProperty("tap2Level", processor_.tap2Level.load());
     data->setProperty("tap3Level", processor_.tap3Level.load());
     data->setProperty("tap4Level", processor_.tap4Level.load());
+    data->setProperty("qualityTier", processor_.qualityTier.load());
+
+   #if DRIFT_STAGE_PROFILING
+    juce::DynamicObject::Ptr stageLoads = new juce::DynamicObject();
+    const auto& profiler = processor_.getStageProfiler();
+    for (int stage = 0; stage < StageProfiler::numStages; ++stage)
+        stageLoads->setProperty(StageProfiler::getStageName(stage), profiler.getStageLoad(stage));
+    data->setProperty("stageLoads", juce::var(stageLoads.get()));
+   #endif
 
     webView_->emitEventIfBrowserIsVisible("visualizerData", juce::var(data.get()));
+
+    sendSpectrum();
+}
+
+void DriftEditor::sendSpectrum()
+{
+    // Analysis pauses whenever the UI can't be seen
+    auto& analyzer = processor_.getSpectrumAnalyzer();
+    analyzer.setEnabled(webView_->isShowing());
+
+    SpectrumAnalyzer::Spectrum spectrum;
+    if (! analyzer.getLatestSpectrum(spectrum))
+        return;
+
+    juce::Array<juce::var> dry, wet;
+    for (int band = 0; band < SpectrumAnalyzer::kNumBands; ++band)
+    {
+        dry.add(static_cast<int>(spectrum.dry[static_cast<size_t>(band)]));
+        wet.add(static_cast<int>(spectrum.wet[static_cast<size_t>(band)]));
+    }
+
+    juce::DynamicObject::Ptr data = new juce::DynamicObject();
+    data->setProperty("minFrequency", SpectrumAnalyzer::kMinFrequency);
+    data->setProperty("maxFrequency", SpectrumAnalyzer::kMaxFrequency);
+    data->setProperty("floorDb", SpectrumAnalyzer::kFloorDb);
+    data->setProperty("dry", dry);
+    data->setProperty("wet", wet);
+
+    webView_->emitEventIfBrowserIsVisible("spectrumData", juce::var(data.get()));
 }
 
 void DriftEditor::paint(juce::Graphics& g)
@@ -192,12 +180,15 @@ void DriftEditor::sendActivationState()
     juce::DynamicObject::Ptr data = new juce::DynamicObject();
 
 #if BEATCONNECT_ACTIVATION_ENABLED
+    // Until validation finishes, the service answers from its cached token
+    auto* service = processor_.getActivationService();
     auto* activation = processor_.getActivation();
-    bool isConfigured = (activation != nullptr);
-    bool isActivated = isConfigured && activation->isActivated();
+    bool isConfigured = (service != nullptr);
+    bool isActivated = isConfigured && service->isActivated();
 
     data->setProperty("isConfigured", isConfigured);
     data->setProperty("isActivated", isActivated);
+    data->setProperty("isValidating", isConfigured && !service->isReady());
 
     if (isActivated && activation)
     {
@@ -254,6 +245,9 @@ void DriftEditor::handleActivateLicense(const juce::var& data)
                 }
                 result->setProperty("status", statusStr);
 
+                if (auto* service = safeThis->processor_.getActivationService())
+                    service->refreshCachedToken();
+
                 if (status == beatconnect::ActivationStatus::Valid ||
                     status == beatconnect::ActivationStatus::AlreadyActive)
                 {
@@ -285,32 +279,29 @@ void DriftEditor::handleActivateLicense(const juce::var& data)
 void DriftEditor::handleDeactivateLicense(const juce::var&)
 {
 #if BEATCONNECT_ACTIVATION_ENABLED
-    auto* activation = processor_.getActivation();
-    if (!activation) return;
+    auto* service = processor_.getActivationService();
+    if (!service || !processor_.getActivation()) return;
 
     juce::Component::SafePointer<DriftEditor> safeThis(this);
 
-    std::thread([safeThis, activation]() {
-        auto status = activation->deactivate();
-
-        juce::MessageManager::callAsync([safeThis, status]() {
-            if (safeThis == nullptr || safeThis->webView_ == nullptr) return;
+    // Runs on the service's own thread, which outlives neither the service nor the plugin
+    service->deactivate([safeThis](beatconnect::ActivationStatus status) {
+        if (safeThis == nullptr || safeThis->webView_ == nullptr) return;
 
-            juce::DynamicObject::Ptr result = new juce::DynamicObject();
+        juce::DynamicObject::Ptr result = new juce::DynamicObject();
 
-            juce::String statusStr;
-            switch (status) {
-                case beatconnect::ActivationStatus::Valid:         statusStr = "valid"; break;
-                case beatconnect::ActivationStatus::NetworkError:  statusStr = "network_error"; break;
-                case beatconnect::ActivationStatus::ServerError:   statusStr = "server_error"; break;
-                case beatconnect::ActivationStatus::NotActivated:  statusStr = "not_activated"; break;
-                default: statusStr = "success"; break;
-            }
-            result->setProperty("status", statusStr);
+        juce::String statusStr;
+        switch (status) {
+            case beatconnect::ActivationStatus::Valid:         statusStr = "valid"; break;
+            case beatconnect::ActivationStatus::NetworkError:  statusStr = "network_error"; break;
+            case beatconnect::ActivationStatus::ServerError:   statusStr = "server_error"; break;
+            case beatconnect::ActivationStatus::NotActivated:  statusStr = "not_activated"; break;
+            default: statusStr = "success"; break;
+        }
+        result->setProperty("status", statusStr);
 
-            safeThis->webView_->emitEventIfBrowserIsVisible("deactivationResult", juce::var(result.get()));
-        });
-    }).detach();
+        safeThis->webView_->emitEventIfBrowserIsVisible("deactivationResult", juce::var(result.get()));
+    });
 #endif
 }
 
@@ -318,3 +309,8 @@ void DriftEditor::handleGetActivationStatus()
 {
     sendActivationState();
 }
+
+void DriftEditor::changeListenerCallback(juce::ChangeBroadcaster*)
+{
+    sendActivationState();
+}
@@ -1,28 +1,54 @@
 #include "PluginProcessor.h"
-#include "PluginEditor.h"
+#if ! DRIFT_HEADLESS
+ #include "PluginEditor.h"
+#endif
 #include "ParameterIDs.h"
+#include "ProjectInfo.h"
+#include <algorithm>
 #include <cmath>
 
-#if HAS_PROJECT_DATA
-#include "ProjectData.h"
-#endif
-
 DriftProcessor::DriftProcessor()
     : AudioProcessor(BusesProperties()
                      .withInput("Input", juce::AudioChannelSet::stereo(), true)
                      .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
       apvts_(*this, nullptr, "Parameters", createParameterLayout())
 {
-    loadProjectData();
+    for (int i = 0; i < ParameterIDs::numParameters; ++i)
+    {
+        parameters_[static_cast<size_t>(i)] = apvts_.getParameter(ParameterIDs::all[static_cast<size_t>(i)]);
+
+       #if DRIFT_CLAP
+        // clap-juce-extensions derives CLAP param ids from the JUCE parameter id hash
+        clapParamIds_[static_cast<size_t>(i)] = static_cast<clap_id>(juce::String(ParameterIDs::all[static_cast<size_t>(i)]).hashCode());
+       #endif
+    }
+
+    addFactoryPresets();
+
+    if (hasActivationEnabled())
+        activationService_ = std::make_unique<juce::SharedResourcePointer<ActivationService>>();
 
     delayBufferL_.fill(0.0f);
     delayBufferR_.fill(0.0f);
 
-    for (int i = 0; i < kNumAllpasses; ++i)
+    for (size_t i = 0; i < allpassBufferL_.size(); ++i)
     {
         allpassBufferL_[i].fill(0.0f);
         allpassBufferR_[i].fill(0.0f);
-        allpassWritePos_[i] = 0;
+        allpassWritePosL_[i] = 0;
+        allpassWritePosR_[i] = 0;
+    }
+
+    // Resized to the host's block size in prepareToPlay
+    stages_.allocate(kMinChunkCapacity);
+
+    // Capture every instance's session for offline replay (see SessionCapture.h)
+    const auto captureDir = juce::SystemStats::getEnvironmentVariable("DRIFT_CAPTURE_DIR", {});
+    if (captureDir.isNotEmpty())
+    {
+        const auto name = "DRIFT-" + juce::Time::getCurrentTime().formatted("%Y%m%d-%H%M%S")
+                        + "-" + juce::String::toHexString(static_cast<juce::int64>(reinterpret_cast<juce::pointer_sized_int>(this)));
+        startSessionCapture(juce::File(captureDir).getChildFile(name).withFileExtension("driftcap"));
     }
 }
 
@@ -104,6 +130,8 @@ float DriftProcessor::getTempoSyncedTimeMs(int divisionIndex, double bpm) const
 void DriftProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     sampleRate_ = sampleRate;
+    kernels_ = &DriftKernels::get();
+    numPendingParamEvents_ = 0;
 
     smoothTime_.reset(sampleRate, 0.05);
     smoothFeedback_.reset(sampleRate, 0.02);
@@ -138,11 +166,12 @@ void DriftProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     ageFilterStateL_.fill(0.0f);
     ageFilterStateR_.fill(0.0f);
 
-    for (int i = 0; i < kNumAllpasses; ++i)
+    for (size_t i = 0; i < allpassBufferL_.size(); ++i)
     {
         allpassBufferL_[i].fill(0.0f);
         allpassBufferR_[i].fill(0.0f);
-        allpassWritePos_[i] = 0;
+        allpassWritePosL_[i] = 0;
+        allpassWritePosR_[i] = 0;
         allpassStateL_[i] = 0.0f;
         allpassStateR_[i] = 0.0f;
     }
@@ -150,6 +179,31 @@ void DriftProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     driftPhase1_ = 0.0f;
     driftPhase2_ = 0.33f;
     driftPhase3_ = 0.66f;
+    driftAmount_ = 0.0f;
+    driftStep_ = 0.0f;
+    controlCountdown_ = 0;
+
+    for (auto& blend : diffusionBlend_)
+    {
+        blend.reset(sampleRate, kQualityCrossfadeSeconds);
+        blend.setCurrentAndTargetValue(1.0f);
+    }
+    lpBlend_.reset(sampleRate, kQualityCrossfadeSeconds);
+    lpBlend_.setCurrentAndTargetValue(1.0f);
+
+    governor_.prepare(sampleRate);
+    profiler_.prepare(sampleRate);
+    analyzer_.prepare(sampleRate);
+
+    stages_.allocate(juce::jlimit(kMinChunkCapacity, kMaxChunkCapacity, samplesPerBlock));
+
+    if (capture_.isActive())
+    {
+        auto record = capture_.beginRecord(1 + 8 + 4);
+        record.write(SessionCapture::prepareRecord);
+        record.write(sampleRate);
+        record.write(static_cast<juce::int32>(samplesPerBlock));
+    }
 }
 
 void DriftProcessor::releaseResources() {}
@@ -163,84 +217,245 @@ bool DriftProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
     return true;
 }
 
-float DriftProcessor::readDelayInterp(const std::array<float, kDelayBufferSize>& buffer, float delaySamples) const
+float DriftProcessor::getDelayReadPosition(int offset, float delaySamples) const
 {
-    float readPos = static_cast<float>(writePos_) - delaySamples;
-    while (readPos < 0) readPos += kDelayBufferSize;
+    int pos = writePos_ + offset;
+    if (pos >= kDelayBufferSize) pos -= kDelayBufferSize;
 
-    int idx0 = static_cast<int>(readPos) % kDelayBufferSize;
-    int idx1 = (idx0 + 1) % kDelayBufferSize;
-    float frac = readPos - std::floor(readPos);
+    float readPos = static_cast<float>(pos) - delaySamples;
+    if (readPos < 0) readPos += kDelayBufferSize;
 
-    return buffer[idx0] * (1.0f - frac) + buffer[idx1] * frac;
+    return readPos;
 }
 
-float DriftProcessor::processSaturation(float input, float amount) const
+float DriftProcessor::processAllpass(float input, int index, bool isLeft, float coeff)
 {
-    if (amount < 0.001f) return input;
+    const auto i = static_cast<size_t>(index);
+    auto& buffer = isLeft ? allpassBufferL_[i] : allpassBufferR_[i];
+    int& writePos = isLeft ? allpassWritePosL_[i] : allpassWritePosR_[i];
 
-    const float drive = 1.0f + amount * 4.0f;
-    const float x = input * drive;
-    const float saturated = x / (1.0f + std::abs(x));
+    const int delayLen = kAllpassDelays[i];
+    const int readPos = (writePos - delayLen + kAllpassBufferSize) % kAllpassBufferSize;
 
-    return input * (1.0f - amount) + saturated * amount;
+    const float delayed = buffer[static_cast<size_t>(readPos)];
+    const float output = delayed - coeff * input;
+    buffer[static_cast<size_t>(writePos)] = input + coeff * output;
+
+    writePos = (writePos + 1) % kAllpassBufferSize;
+
+    return output;
 }
 
-float DriftProcessor::processAllpass(float input, int index, bool isLeft, float coeff)
+void DriftProcessor::queueParamEvent(int sampleOffset, int index, float value) noexcept
 {
-    auto& buffer = isLeft ? allpassBufferL_[index] : allpassBufferR_[index];
-    int& writePos = allpassWritePos_[index];
+    // Called by the CLAP wrapper outside processBlock, so checked on its own
+    RealtimeSafety::ScopedAudioCallback realtimeScope;
+
+    if (numPendingParamEvents_ < kMaxParamEvents)
+    {
+        pendingParamEvents_[static_cast<size_t>(numPendingParamEvents_++)] = { sampleOffset, index, value };
+        return;
+    }
 
-    const int delayLen = kAllpassDelays[index];
-    const int readPos = (writePos - delayLen + 1024) % 1024;
+    // Queue full: apply everything queued so far at the start of the block, in order,
+    // so later events still land after earlier ones, and start a fresh queue
+    for (int e = 0; e < numPendingParamEvents_; ++e)
+    {
+        const auto& pending = pendingParamEvents_[static_cast<size_t>(e)];
+        setParameterFromAudioThread(pending.index, pending.value);
+    }
 
-    const float delayed = buffer[readPos];
-    const float output = delayed - coeff * input;
-    buffer[writePos] = input + coeff * output;
+    pendingParamEvents_[0] = { sampleOffset, index, value };
+    numPendingParamEvents_ = 1;
+}
 
-    writePos = (writePos + 1) % 1024;
+void DriftProcessor::setParameterFromAudioThread(int index, float value) noexcept
+{
+    auto* param = parameters_[static_cast<size_t>(index)];
+    const float normalised = param->convertTo0to1(value);
 
-    return output;
+    if (param->getValue() != normalised)
+        param->setValue(normalised);
+}
+
+#if DRIFT_CLAP
+bool DriftProcessor::supportsDirectEvent(uint16_t spaceId, uint16_t type)
+{
+    return spaceId == CLAP_CORE_EVENT_SPACE_ID && type == CLAP_EVENT_PARAM_VALUE;
+}
+
+void DriftProcessor::handleDirectEvent(const clap_event_header_t* event, int sampleOffset)
+{
+    if (event->space_id != CLAP_CORE_EVENT_SPACE_ID || event->type != CLAP_EVENT_PARAM_VALUE)
+        return;
+
+    const auto* paramEvent = reinterpret_cast<const clap_event_param_value_t*>(event);
+    for (size_t i = 0; i < clapParamIds_.size(); ++i)
+    {
+        if (clapParamIds_[i] != paramEvent->param_id)
+            continue;
+
+        // The wrapper exposes normalised values, the DSP works in parameter units
+        const float value = parameters_[i]->convertFrom0to1(static_cast<float>(paramEvent->value));
+        queueParamEvent(static_cast<int>(event->time) - sampleOffset, static_cast<int>(i), value);
+        return;
+    }
+}
+#endif
+
+bool DriftProcessor::startSessionCapture(const juce::File& file)
+{
+    juce::StringArray ids;
+    for (const auto* id : ParameterIDs::all)
+        ids.add(id);
+
+    // Started mid-session: the current configuration goes in ahead of the first block
+    return capture_.start(file, ids, getSampleRate(), getBlockSize());
+}
+
+void DriftProcessor::stopSessionCapture()
+{
+    capture_.stop();
+}
+
+void DriftProcessor::captureBlock(const juce::AudioBuffer<float>& buffer, const RawParameters& raw, double bpm)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int numChannels = buffer.getNumChannels();
+    const int numEvents = numPendingParamEvents_;
+
+    const int size = 1 + 4 + 4 + 4 + 8 + 4
+                   + static_cast<int>(sizeof(float)) * ParameterIDs::numParameters
+                   + 4 + 12 * numEvents
+                   + static_cast<int>(sizeof(float)) * numChannels * numSamples;
+
+    // Sequence advances even when the record is dropped, so replay sees the gap
+    const auto sequence = static_cast<juce::int32>(captureSequence_++);
+
+    auto record = capture_.beginRecord(size);
+    if (! record.isValid())
+        return;
+
+    record.write(SessionCapture::blockRecord);
+    record.write(sequence);
+    record.write(static_cast<juce::int32>(numSamples));
+    record.write(static_cast<juce::int32>(numChannels));
+    record.write(bpm);
+    record.write(static_cast<juce::int32>(governor_.getCurrentTier()));
+    record.writeArray(raw.data(), ParameterIDs::numParameters);
+
+    record.write(static_cast<juce::int32>(numEvents));
+    for (int e = 0; e < numEvents; ++e)
+    {
+        const auto& event = pendingParamEvents_[static_cast<size_t>(e)];
+        record.write(static_cast<juce::int32>(event.sampleOffset));
+        record.write(static_cast<juce::int32>(event.index));
+        record.write(event.value);
+    }
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        record.writeArray(buffer.getReadPointer(channel), numSamples);
+}
+
+double DriftProcessor::getHostBpm() const
+{
+    if (auto* playHead = getPlayHead())
+    {
+        if (auto posInfo = playHead->getPosition())
+        {
+            if (posInfo->getBpm().hasValue())
+                return *posInfo->getBpm();
+        }
+    }
+    return 120.0;
 }
 
 void DriftProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
 {
     juce::ScopedNoDenormals noDenormals;
+    RealtimeSafety::ScopedAudioCallback realtimeScope;
+    governor_.setNonRealtime(isNonRealtime());
+    const auto blockStartTicks = governor_.beginBlock();
 
     const int numSamples = buffer.getNumSamples();
+
+    // A restore or preset recall in progress is used whole, not parameter by parameter
+    RawParameters raw;
+    if (! readHeldSnapshot(raw))
+    {
+        for (size_t i = 0; i < raw.size(); ++i)
+            raw[i] = parameters_[i]->convertFrom0to1(parameters_[i]->getValue());
+    }
+
+    // Get tempo from host if sync is (or may become) enabled, or it is being captured
+    const bool mayNeedTempo = raw[ParameterIDs::syncIndex] > 0.5f || numPendingParamEvents_ > 0
+                           || capture_.isActive();
+    const double bpm = mayNeedTempo ? getHostBpm() : 120.0;
+
+    if (capture_.isActive())
+        captureBlock(buffer, raw, bpm);
+
+    BlockMeters meters;
+    int start = 0;
+
+    // Sample-accurate parameter events (CLAP): render up to each event, then apply it
+    for (int e = 0; e < numPendingParamEvents_; ++e)
+    {
+        const auto& event = pendingParamEvents_[static_cast<size_t>(e)];
+        const int offset = juce::jlimit(start, numSamples, event.sampleOffset);
+
+        if (offset > start)
+        {
+            renderRange(buffer, start, offset, raw, bpm, meters);
+            start = offset;
+        }
+
+        raw[static_cast<size_t>(event.index)] = event.value;
+
+        // So the next block, saved state and the editor all see what the DSP now uses
+        setParameterFromAudioThread(event.index, event.value);
+    }
+    numPendingParamEvents_ = 0;
+
+    if (start < numSamples)
+        renderRange(buffer, start, numSamples, raw, bpm, meters);
+
+    inputLevel.store(meters.peakIn);
+    duckEnvelope.store(meters.driftViz);
+    tap1Level.store(meters.tapLevels[0]);
+    tap2Level.store(meters.tapLevels[1]);
+    tap3Level.store(meters.tapLevels[2]);
+    tap4Level.store(meters.tapLevels[3]);
+
+    governor_.endBlock(blockStartTicks, numSamples);
+    profiler_.endBlock(numSamples);
+    qualityTier.store(governor_.getCurrentTier());
+}
+
+void DriftProcessor::renderRange(juce::AudioBuffer<float>& buffer, int begin, int end,
+                                 const RawParameters& raw, double bpm, BlockMeters& meters)
+{
+    const auto& tier = QualityGovernor::getTier(governor_.getCurrentTier());
+
     auto* leftIn = buffer.getReadPointer(0);
     auto* rightIn = buffer.getReadPointer(1);
     auto* leftOut = buffer.getWritePointer(0);
     auto* rightOut = buffer.getWritePointer(1);
 
     // Get parameters
-    float timeMs = apvts_.getRawParameterValue(ParameterIDs::time)->load();
-    const bool syncEnabled = apvts_.getRawParameterValue(ParameterIDs::sync)->load() > 0.5f;
-    const int divisionIdx = static_cast<int>(apvts_.getRawParameterValue(ParameterIDs::division)->load());
+    float timeMs = raw[ParameterIDs::timeIndex];
+    const bool syncEnabled = raw[ParameterIDs::syncIndex] > 0.5f;
+    const int divisionIdx = static_cast<int>(raw[ParameterIDs::divisionIndex]);
 
-    // Get tempo from host if sync is enabled
     if (syncEnabled)
-    {
-        double bpm = 120.0;
-        if (auto* playHead = getPlayHead())
-        {
-            if (auto posInfo = playHead->getPosition())
-            {
-                if (posInfo->getBpm().hasValue())
-                    bpm = *posInfo->getBpm();
-            }
-        }
         timeMs = getTempoSyncedTimeMs(divisionIdx, bpm);
-    }
 
-    const float feedbackPct = apvts_.getRawParameterValue(ParameterIDs::feedback)->load() / 100.0f;
-    const float duckPct = apvts_.getRawParameterValue(ParameterIDs::duck)->load() / 100.0f;
-    const int numTaps = static_cast<int>(apvts_.getRawParameterValue(ParameterIDs::taps)->load());
-    const float spreadPct = apvts_.getRawParameterValue(ParameterIDs::spread)->load() / 100.0f;
-    const float mixPct = apvts_.getRawParameterValue(ParameterIDs::mix)->load() / 100.0f;
-    const float gritPct = apvts_.getRawParameterValue(ParameterIDs::grit)->load() / 100.0f;
-    const float agePct = apvts_.getRawParameterValue(ParameterIDs::age)->load() / 100.0f;
-    const float diffusePct = apvts_.getRawParameterValue(ParameterIDs::diffuse)->load() / 100.0f;
+    const float feedbackPct = raw[ParameterIDs::feedbackIndex] / 100.0f;
+    const float spreadPct = raw[ParameterIDs::spreadIndex] / 100.0f;
+    const float mixPct = raw[ParameterIDs::mixIndex] / 100.0f;
+    const float gritPct = raw[ParameterIDs::gritIndex] / 100.0f;
+    const float agePct = raw[ParameterIDs::ageIndex] / 100.0f;
+    const float diffusePct = raw[ParameterIDs::diffuseIndex] / 100.0f;
 
     smoothTime_.setTargetValue(timeMs);
     smoothFeedback_.setTargetValue(feedbackPct);
@@ -250,229 +465,517 @@ void DriftProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
     smoothAge_.setTargetValue(agePct);
     smoothDiffuse_.setTargetValue(diffusePct);
 
-    const float duckAttack = std::exp(-1.0f / (static_cast<float>(sampleRate_) * 0.005f));
-    const float duckRelease = std::exp(-1.0f / (static_cast<float>(sampleRate_) * 0.2f));
-
-    const float driftRate1 = 0.13f / static_cast<float>(sampleRate_);
-    const float driftRate2 = 0.089f / static_cast<float>(sampleRate_);
-    const float driftRate3 = 0.21f / static_cast<float>(sampleRate_);
+    StageSettings settings;
+    settings.tier = &tier;
+    settings.numTaps = juce::jlimit(1, kMaxTaps, static_cast<int>(raw[ParameterIDs::tapsIndex]));
+    settings.duckPct = raw[ParameterIDs::duckIndex] / 100.0f;
+    settings.duckAttack = std::exp(-1.0f / (static_cast<float>(sampleRate_) * 0.005f));
+    settings.duckRelease = std::exp(-1.0f / (static_cast<float>(sampleRate_) * 0.2f));
+    settings.driftRate1 = 0.13f / static_cast<float>(sampleRate_);
+    settings.driftRate2 = 0.089f / static_cast<float>(sampleRate_);
+    settings.driftRate3 = 0.21f / static_cast<float>(sampleRate_);
 
-    float peakIn = 0.0f;
-    std::array<float, 4> tapLevels = { 0.0f, 0.0f, 0.0f, 0.0f };
-    float driftViz = 0.0f;
+    lpBlend_.setTargetValue(tier.smoothingFilter ? 1.0f : 0.0f);
 
-    for (int i = 0; i < numSamples; ++i)
+    for (int start = begin; start < end;)
     {
-        const float dryL = leftIn[i];
-        const float dryR = rightIn[i];
+        // Every delay-line read in a chunk must land before the chunk's first write,
+        // so chunks stay shorter than the shortest delay the drift LFOs can reach.
+        // That keeps the feedback recursion the only thing tied to the chunk length.
+        const float minTimeMs = std::min(smoothTime_.getCurrentValue(), smoothTime_.getTargetValue());
+        const int minDelay = static_cast<int>(minTimeMs * static_cast<float>(sampleRate_) / 1000.0f * kMinDriftMod);
+        const int n = juce::jlimit(1, std::min(stages_.maxChunkSize, end - start), minDelay - 2);
 
-        const float inputAbs = std::max(std::abs(dryL), std::abs(dryR));
-        peakIn = std::max(peakIn, inputAbs);
+        const float* dryL = leftIn + start;
+        const float* dryR = rightIn + start;
+
+        {
+            StageProfiler::Scope scope(profiler_, StageProfiler::control);
+            runControlStage(dryL, dryR, n, settings, meters);
+        }
+        {
+            StageProfiler::Scope scope(profiler_, StageProfiler::tapRead);
+            runTapReadStage(n, settings);
+        }
+        {
+            StageProfiler::Scope scope(profiler_, StageProfiler::diffusion);
+            runDiffusionStage(n, settings);
+        }
+        {
+            StageProfiler::Scope scope(profiler_, StageProfiler::tapSum);
+            runTapSumStage(n, settings, meters);
+        }
+        {
+            StageProfiler::Scope scope(profiler_, StageProfiler::wetFilter);
+            runWetFilterStage(n);
+        }
+        {
+            StageProfiler::Scope scope(profiler_, StageProfiler::feedback);
+            runFeedbackStage(dryL, dryR, n);
+        }
+        {
+            // Before the mix, which writes the output over the dry input in place
+            StageProfiler::Scope scope(profiler_, StageProfiler::analysis);
+            analyzer_.push(dryL, dryR, stages_.wetL, stages_.wetR, n);
+        }
+        {
+            StageProfiler::Scope scope(profiler_, StageProfiler::mix);
+            kernels_->mix(dryL, stages_.wetL, stages_.mix, leftOut + start, n);
+            kernels_->mix(dryR, stages_.wetR, stages_.mix, rightOut + start, n);
+        }
+
+        start += n;
+    }
+}
+
+// ==============================================================================
+// Pipeline stages. Each works on a whole chunk, from and into stages_.
+// ==============================================================================
+
+void DriftProcessor::runControlStage(const float* dryL, const float* dryR, int n,
+                                     const StageSettings& settings, BlockMeters& meters)
+{
+    auto& st = stages_;
+    const auto& tier = *settings.tier;
+
+    for (int i = 0; i < n; ++i)
+    {
+        const float inputAbs = std::max(std::abs(dryL[i]), std::abs(dryR[i]));
+        meters.peakIn = std::max(meters.peakIn, inputAbs);
 
         if (inputAbs > duckEnv_)
-            duckEnv_ = duckAttack * duckEnv_ + (1.0f - duckAttack) * inputAbs;
+            duckEnv_ = settings.duckAttack * duckEnv_ + (1.0f - settings.duckAttack) * inputAbs;
         else
-            duckEnv_ = duckRelease * duckEnv_;
-
-        const float duckGain = 1.0f - std::min(1.0f, duckEnv_ * 2.0f) * duckPct;
-
-        const float currentTime = smoothTime_.getNextValue();
-        const float currentFeedback = smoothFeedback_.getNextValue();
-        const float currentMix = smoothMix_.getNextValue();
-        const float currentSpread = smoothSpread_.getNextValue();
-        const float currentGrit = smoothGrit_.getNextValue();
-        const float currentAge = smoothAge_.getNextValue();
-        const float currentDiffuse = smoothDiffuse_.getNextValue();
-
-        driftPhase1_ += driftRate1;
-        driftPhase2_ += driftRate2;
-        driftPhase3_ += driftRate3;
-        if (driftPhase1_ > 1.0f) driftPhase1_ -= 1.0f;
-        if (driftPhase2_ > 1.0f) driftPhase2_ -= 1.0f;
-        if (driftPhase3_ > 1.0f) driftPhase3_ -= 1.0f;
-
-        const float drift1 = std::sin(driftPhase1_ * 2.0f * juce::MathConstants<float>::pi);
-        const float drift2 = std::sin(driftPhase2_ * 2.0f * juce::MathConstants<float>::pi);
-        const float drift3 = std::sin(driftPhase3_ * 2.0f * juce::MathConstants<float>::pi);
-        const float driftAmount = (drift1 * 0.5f + drift2 * 0.3f + drift3 * 0.2f);
-        driftViz = driftAmount;
-
-        const float driftMod = 1.0f + driftAmount * 0.08f;
-        const float baseSamples = currentTime * static_cast<float>(sampleRate_) / 1000.0f;
-
-        float wetL = 0.0f;
-        float wetR = 0.0f;
-
-        for (int tap = 0; tap < numTaps; ++tap)
+            duckEnv_ = settings.duckRelease * duckEnv_;
+
+        st.duckGain[i] = 1.0f - std::min(1.0f, duckEnv_ * 2.0f) * settings.duckPct;
+
+        st.baseSamples[i] = smoothTime_.getNextValue() * static_cast<float>(sampleRate_) / 1000.0f;
+        st.feedback[i] = smoothFeedback_.getNextValue();
+        st.mix[i] = smoothMix_.getNextValue();
+        st.spread[i] = smoothSpread_.getNextValue();
+        st.grit[i] = smoothGrit_.getNextValue();
+        st.age[i] = smoothAge_.getNextValue();
+        st.diffuse[i] = smoothDiffuse_.getNextValue();
+
+        // Drift LFOs run at the tier's control rate, interpolated in between
+        if (--controlCountdown_ <= 0)
         {
-            const float tapDriftMod = 1.0f + driftAmount * 0.08f * (1.0f + tap * 0.3f);
-            const float tapMultiplier = static_cast<float>(tap + 1);
-            float tapSamples = baseSamples * tapMultiplier * tapDriftMod;
-            tapSamples = std::max(1.0f, std::min(tapSamples, static_cast<float>(kDelayBufferSize - 2)));
+            controlCountdown_ = tier.controlInterval;
+            const float interval = static_cast<float>(tier.controlInterval);
+
+            driftPhase1_ += settings.driftRate1 * interval;
+            driftPhase2_ += settings.driftRate2 * interval;
+            driftPhase3_ += settings.driftRate3 * interval;
+            if (driftPhase1_ > 1.0f) driftPhase1_ -= 1.0f;
+            if (driftPhase2_ > 1.0f) driftPhase2_ -= 1.0f;
+            if (driftPhase3_ > 1.0f) driftPhase3_ -= 1.0f;
+
+            const float drift1 = std::sin(driftPhase1_ * 2.0f * juce::MathConstants<float>::pi);
+            const float drift2 = std::sin(driftPhase2_ * 2.0f * juce::MathConstants<float>::pi);
+            const float drift3 = std::sin(driftPhase3_ * 2.0f * juce::MathConstants<float>::pi);
+            const float driftTarget = (drift1 * 0.5f + drift2 * 0.3f + drift3 * 0.2f);
+            driftStep_ = (driftTarget - driftAmount_) / interval;
+        }
 
-            const float tapAmp = std::pow(0.7f + currentFeedback * 0.25f, static_cast<float>(tap));
-
-            // Progressive character per tap (later taps get more character)
-            const float tapCharacterMult = 0.25f + (static_cast<float>(tap) / 3.0f) * 0.75f;
-            const float tapGrit = currentGrit * tapCharacterMult;
-            const float tapAge = currentAge * tapCharacterMult;
-            const float tapDiffuse = currentDiffuse * tapCharacterMult;
-
-            const float spreadAmount = currentSpread * (static_cast<float>(tap) / 3.0f);
-            float panL, panR;
-            if (tap % 2 == 0) {
-                panL = 1.0f;
-                panR = 1.0f - spreadAmount * 0.7f;
-            } else {
-                panL = 1.0f - spreadAmount * 0.7f;
-                panR = 1.0f;
-            }
+        driftAmount_ += driftStep_;
+        st.drift[i] = driftAmount_;
+    }
+
+    meters.driftViz = st.drift[n - 1];
+}
 
-            float tapL = readDelayInterp(delayBufferL_, tapSamples);
-            float tapR = readDelayInterp(delayBufferR_, tapSamples);
+void DriftProcessor::runTapReadStage(int n, const StageSettings& settings)
+{
+    auto& st = stages_;
+    const auto& kernels = *kernels_;
 
-            // Per-tap age filtering
+    for (int tap = 0; tap < settings.numTaps; ++tap)
+    {
+        const auto tapIndex = static_cast<size_t>(tap);
+        const float tapMultiplier = static_cast<float>(tap + 1);
+        const float tapCharacterMult = getTapCharacter(tap);
+        float* tapL = st.tapL[tapIndex];
+        float* tapR = st.tapR[tapIndex];
+
+        for (int i = 0; i < n; ++i)
+        {
+            const float tapDriftMod = 1.0f + st.drift[i] * 0.08f * (1.0f + tap * 0.3f);
+            float tapSamples = st.baseSamples[i] * tapMultiplier * tapDriftMod;
+            tapSamples = std::max(1.0f, std::min(tapSamples, static_cast<float>(kDelayBufferSize - 2)));
+            st.readPos[i] = getDelayReadPosition(i, tapSamples);
+            st.tapGrit[i] = st.grit[i] * tapCharacterMult;
+        }
+
+        kernels.readInterp(delayBufferL_.data(), kDelayBufferSize, st.readPos, tapL, n);
+        kernels.readInterp(delayBufferR_.data(), kDelayBufferSize, st.readPos, tapR, n);
+
+        // Per-tap age filtering (recursive, stays per-sample)
+        for (int i = 0; i < n; ++i)
+        {
+            const float tapAge = st.age[i] * tapCharacterMult;
             if (tapAge > 0.001f)
             {
                 const float ageCoeff = 1.0f - tapAge * 0.7f;
-                ageFilterStateL_[tap] = ageFilterStateL_[tap] + ageCoeff * (tapL - ageFilterStateL_[tap]);
-                ageFilterStateR_[tap] = ageFilterStateR_[tap] + ageCoeff * (tapR - ageFilterStateR_[tap]);
-                tapL = ageFilterStateL_[tap];
-                tapR = ageFilterStateR_[tap];
+                auto& stateL = ageFilterStateL_[tapIndex];
+                auto& stateR = ageFilterStateR_[tapIndex];
+                stateL = stateL + ageCoeff * (tapL[i] - stateL);
+                stateR = stateR + ageCoeff * (tapR[i] - stateR);
+                tapL[i] = stateL;
+                tapR[i] = stateR;
             }
+        }
+
+        // Per-tap saturation
+        kernels.saturate(tapL, st.tapGrit, n);
+        kernels.saturate(tapR, st.tapGrit, n);
+    }
+}
+
+void DriftProcessor::runDiffusionStage(int n, const StageSettings& settings)
+{
+    auto& st = stages_;
+    const auto& kernels = *kernels_;
+
+    for (int tap = 0; tap < settings.numTaps; ++tap)
+    {
+        const auto tapIndex = static_cast<size_t>(tap);
+        const float tapCharacterMult = getTapCharacter(tap);
+        float* tapL = st.tapL[tapIndex];
+        float* tapR = st.tapR[tapIndex];
+
+        // Per-tap diffusion (using different allpass indices per tap), crossfaded
+        // in and out as the quality tier changes how many taps are diffused
+        auto& diffusionBlend = diffusionBlend_[tapIndex];
+        diffusionBlend.setTargetValue(tap < settings.tier->diffusedTaps ? 1.0f : 0.0f);
+
+        const bool diffusionCrossfading = diffusionBlend.isSmoothing();
+        if (! diffusionCrossfading && diffusionBlend.getTargetValue() <= 0.0f)
+            continue;
+
+        if (diffusionCrossfading)
+        {
+            std::copy_n(tapL, n, st.preDiffuseL);
+            std::copy_n(tapR, n, st.preDiffuseR);
+        }
+
+        int numDiffused = 0;
+        for (int i = 0; i < n; ++i)
+        {
+            const float tapDiffuse = st.diffuse[i] * tapCharacterMult;
+            st.coeff[i] = 0.5f + tapDiffuse * 0.35f;
+            numDiffused += tapDiffuse > 0.001f ? 1 : 0;
+        }
 
-            // Per-tap saturation
-            tapL = processSaturation(tapL, tapGrit);
-            tapR = processSaturation(tapR, tapGrit);
+        if (numDiffused == n)
+        {
+            // The allpass kernel must not read its own writes, so feed it runs no
+            // longer than the allpass delay
+            for (int done = 0; done < n;)
+            {
+                const int len = std::min(n - done, kAllpassDelays[tapIndex]);
+                kernels.allpass(tapL + done, st.coeff + done, len, allpassBufferL_[tapIndex].data(),
+                                kAllpassBufferSize, allpassWritePosL_[tapIndex], kAllpassDelays[tapIndex]);
+                kernels.allpass(tapR + done, st.coeff + done, len, allpassBufferR_[tapIndex].data(),
+                                kAllpassBufferSize, allpassWritePosR_[tapIndex], kAllpassDelays[tapIndex]);
+                allpassWritePosL_[tapIndex] = (allpassWritePosL_[tapIndex] + len) % kAllpassBufferSize;
+                allpassWritePosR_[tapIndex] = (allpassWritePosR_[tapIndex] + len) % kAllpassBufferSize;
+                done += len;
+            }
+        }
+        else if (numDiffused > 0)
+        {
+            // Diffuse is crossing its threshold inside this chunk
+            for (int i = 0; i < n; ++i)
+            {
+                if (st.diffuse[i] * tapCharacterMult > 0.001f)
+                {
+                    tapL[i] = processAllpass(tapL[i], tap, true, st.coeff[i]);
+                    tapR[i] = processAllpass(tapR[i], tap, false, st.coeff[i]);
+                }
+            }
+        }
 
-            // Per-tap diffusion (using different allpass indices per tap)
-            if (tapDiffuse > 0.001f && tap < kNumAllpasses)
+        if (diffusionCrossfading)
+        {
+            for (int i = 0; i < n; ++i)
             {
-                const float diffCoeff = 0.5f + tapDiffuse * 0.35f;
-                tapL = processAllpass(tapL, tap, true, diffCoeff);
-                tapR = processAllpass(tapR, tap, false, diffCoeff);
+                const float blend = diffusionBlend.getNextValue();
+                tapL[i] = st.preDiffuseL[i] + blend * (tapL[i] - st.preDiffuseL[i]);
+                tapR[i] = st.preDiffuseR[i] + blend * (tapR[i] - st.preDiffuseR[i]);
             }
+        }
+    }
+}
+
+void DriftProcessor::runTapSumStage(int n, const StageSettings& settings, BlockMeters& meters)
+{
+    auto& st = stages_;
+    const auto& kernels = *kernels_;
+
+    std::fill_n(st.wetL, n, 0.0f);
+    std::fill_n(st.wetR, n, 0.0f);
 
-            wetL += tapL * tapAmp * panL;
-            wetR += tapR * tapAmp * panR;
+    for (int tap = 0; tap < settings.numTaps; ++tap)
+    {
+        const auto tapIndex = static_cast<size_t>(tap);
+        const float* tapL = st.tapL[tapIndex];
+        const float* tapR = st.tapR[tapIndex];
+        const float panPosition = static_cast<float>(tap) / 3.0f;
 
-            tapLevels[tap] = std::max(tapLevels[tap], (std::abs(tapL) + std::abs(tapR)) * 0.5f * tapAmp);
+        for (int i = 0; i < n; ++i)
+        {
+            st.tapAmp[i] = std::pow(0.7f + st.feedback[i] * 0.25f, static_cast<float>(tap));
+
+            const float panAtten = 1.0f - st.spread[i] * panPosition * 0.7f;
+            st.gainL[i] = st.tapAmp[i] * (tap % 2 == 0 ? 1.0f : panAtten);
+            st.gainR[i] = st.tapAmp[i] * (tap % 2 == 0 ? panAtten : 1.0f);
         }
 
-        // Global filters
-        wetL = hpFilterL_.processSample(0, wetL);
-        wetR = hpFilterR_.processSample(0, wetR);
-        wetL = lpFilterL_.processSample(0, wetL);
-        wetR = lpFilterR_.processSample(0, wetR);
+        kernels.mulAdd(st.wetL, tapL, st.gainL, n);
+        kernels.mulAdd(st.wetR, tapR, st.gainR, n);
+
+        auto& level = meters.tapLevels[tapIndex];
+        for (int i = 0; i < n; ++i)
+            level = std::max(level, (std::abs(tapL[i]) + std::abs(tapR[i])) * 0.5f * st.tapAmp[i]);
+    }
+}
+
+void DriftProcessor::runWetFilterStage(int n)
+{
+    auto& st = stages_;
 
-        wetL *= duckGain;
-        wetR *= duckGain;
+    // Global filters (recursive, stay per-sample) and ducking. The lowpass is
+    // crossfaded out on the lowest quality tier.
+    const bool lpCrossfading = lpBlend_.isSmoothing();
+    const bool lpActive = lpCrossfading || lpBlend_.getTargetValue() > 0.0f;
 
-        // Feedback path (with global grit for self-oscillation character)
-        float fbL = readDelayInterp(delayBufferL_, baseSamples * driftMod);
-        float fbR = readDelayInterp(delayBufferR_, baseSamples * driftMod);
+    for (int i = 0; i < n; ++i)
+    {
+        float wetL = hpFilterL_.processSample(0, st.wetL[i]);
+        float wetR = hpFilterR_.processSample(0, st.wetR[i]);
 
-        fbL = processSaturation(fbL, currentGrit * 0.5f);
-        fbR = processSaturation(fbR, currentGrit * 0.5f);
+        if (lpCrossfading)
+        {
+            const float blend = lpBlend_.getNextValue();
+            wetL += blend * (lpFilterL_.processSample(0, wetL) - wetL);
+            wetR += blend * (lpFilterR_.processSample(0, wetR) - wetR);
+        }
+        else if (lpActive)
+        {
+            wetL = lpFilterL_.processSample(0, wetL);
+            wetR = lpFilterR_.processSample(0, wetR);
+        }
 
-        delayBufferL_[writePos_] = dryL + fbL * currentFeedback;
-        delayBufferR_[writePos_] = dryR + fbR * currentFeedback;
+        st.wetL[i] = wetL * st.duckGain[i];
+        st.wetR[i] = wetR * st.duckGain[i];
+    }
+}
 
-        writePos_ = (writePos_ + 1) % kDelayBufferSize;
+void DriftProcessor::runFeedbackStage(const float* dryL, const float* dryR, int n)
+{
+    auto& st = stages_;
+    const auto& kernels = *kernels_;
 
-        leftOut[i] = dryL * (1.0f - currentMix) + wetL * currentMix;
-        rightOut[i] = dryR * (1.0f - currentMix) + wetR * currentMix;
+    // Feedback path (with global grit for self-oscillation character)
+    for (int i = 0; i < n; ++i)
+    {
+        const float driftMod = 1.0f + st.drift[i] * 0.08f;
+        const float fbSamples = std::min(st.baseSamples[i] * driftMod, static_cast<float>(kDelayBufferSize - 2));
+        st.readPos[i] = getDelayReadPosition(i, fbSamples);
+        st.fbGrit[i] = st.grit[i] * 0.5f;
     }
 
-    inputLevel.store(peakIn);
-    duckEnvelope.store(driftViz);
-    tap1Level.store(tapLevels[0]);
-    tap2Level.store(tapLevels[1]);
-    tap3Level.store(tapLevels[2]);
-    tap4Level.store(tapLevels[3]);
+    kernels.readInterp(delayBufferL_.data(), kDelayBufferSize, st.readPos, st.fbL, n);
+    kernels.readInterp(delayBufferR_.data(), kDelayBufferSize, st.readPos, st.fbR, n);
+    kernels.saturate(st.fbL, st.fbGrit, n);
+    kernels.saturate(st.fbR, st.fbGrit, n);
+
+    kernels.writeFeedback(delayBufferL_.data(), kDelayBufferSize, writePos_, dryL, st.fbL, st.feedback, n);
+    kernels.writeFeedback(delayBufferR_.data(), kDelayBufferSize, writePos_, dryR, st.fbR, st.feedback, n);
+
+    writePos_ = (writePos_ + n) % kDelayBufferSize;
+}
+
+// ==============================================================================
+// Stage buffers
+// ==============================================================================
+
+void DriftProcessor::StageBuffers::allocate(int maxChunk)
+{
+    maxChunkSize = maxChunk;
+
+    const std::initializer_list<float**> buffers = {
+        &duckGain, &baseSamples, &drift, &feedback, &mix, &spread, &grit, &age, &diffuse,
+        &readPos, &tapGrit, &tapAmp, &gainL, &gainR, &coeff, &preDiffuseL, &preDiffuseR,
+        &wetL, &wetR, &fbL, &fbR, &fbGrit
+    };
+
+    const size_t stride = static_cast<size_t>(maxChunk);
+    storage.assign(stride * (buffers.size() + 2 * kMaxTaps), 0.0f);
+
+    float* next = storage.data();
+    for (auto* buffer : buffers)
+    {
+        *buffer = next;
+        next += stride;
+    }
+
+    for (size_t tap = 0; tap < kMaxTaps; ++tap)
+    {
+        tapL[tap] = next;
+        tapR[tap] = next + stride;
+        next += 2 * stride;
+    }
 }
 
 juce::AudioProcessorEditor* DriftProcessor::createEditor()
 {
+#if DRIFT_HEADLESS
+    return nullptr;
+#else
     return new DriftEditor(*this);
+#endif
 }
 
 void DriftProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    auto state = apvts_.copyState();
-    state.setProperty("stateVersion", kStateVersion, nullptr);
-    std::unique_ptr<juce::XmlElement> xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
+    PluginState::write(captureSnapshot(), destData);
 }
 
 void DriftProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
-    std::unique_ptr<juce::XmlElement> xml(getXmlFromBinary(data, sizeInBytes));
-    if (xml && xml->hasTagName(apvts_.state.getType()))
-    {
-        auto state = juce::ValueTree::fromXml(*xml);
-        apvts_.replaceState(state);
-    }
-}
-
-juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
-{
-    return new DriftProcessor();
+    auto snapshot = getDefaultSnapshot();
+    if (PluginState::read(data, sizeInBytes, snapshot))
+        applySnapshot(snapshot);
 }
 
 // ==============================================================================
-// BeatConnect Integration
+// Parameter Snapshots and Presets
 // ==============================================================================
 
-void DriftProcessor::loadProjectData()
+PluginState::Snapshot DriftProcessor::captureSnapshot() const
 {
-#if HAS_PROJECT_DATA
-    int dataSize = 0;
-    const char* data = ProjectData::getNamedResource("project_data_json", dataSize);
+    PluginState::Snapshot snapshot;
+    for (size_t i = 0; i < parameters_.size(); ++i)
+        snapshot.values[i] = parameters_[i]->convertFrom0to1(parameters_[i]->getValue());
+    return snapshot;
+}
+
+PluginState::Snapshot DriftProcessor::getDefaultSnapshot() const
+{
+    PluginState::Snapshot snapshot;
+    for (size_t i = 0; i < parameters_.size(); ++i)
+        snapshot.values[i] = parameters_[i]->convertFrom0to1(parameters_[i]->getDefaultValue());
+    return snapshot;
+}
 
-    if (data == nullptr || dataSize == 0)
+void DriftProcessor::addFactoryPresets()
+{
+    struct Setting
     {
-        DBG("No project_data.json found in binary data");
-        return;
-    }
+        ParameterIDs::Index index;
+        float value;
+    };
 
-    auto parsed = juce::JSON::parse(juce::String::fromUTF8(data, dataSize));
-    if (parsed.isVoid())
+    auto add = [this](const char* name, std::initializer_list<Setting> settings)
     {
-        DBG("Failed to parse project_data.json");
-        return;
-    }
+        auto snapshot = getDefaultSnapshot();
+        for (const auto& setting : settings)
+            snapshot.values[setting.index] = setting.value;
+        presets_.store(name, snapshot);
+    };
+
+    using namespace ParameterIDs;
+    add("Init", {});
+    add("Slapback", { { timeIndex, 110.0f }, { feedbackIndex, 10.0f }, { tapsIndex, 1.0f }, { duckIndex, 0.0f },
+                      { ageIndex, 15.0f }, { mixIndex, 30.0f } });
+    add("Tape Echo", { { timeIndex, 350.0f }, { feedbackIndex, 45.0f }, { tapsIndex, 1.0f }, { gritIndex, 35.0f },
+                       { ageIndex, 60.0f }, { mixIndex, 35.0f } });
+    add("Dotted Eighths", { { syncIndex, 1.0f }, { divisionIndex, 10.0f }, { feedbackIndex, 40.0f }, { tapsIndex, 2.0f },
+                            { spreadIndex, 70.0f }, { duckIndex, 50.0f }, { mixIndex, 30.0f } });
+    add("Wandering Wash", { { timeIndex, 900.0f }, { feedbackIndex, 75.0f }, { tapsIndex, 4.0f }, { spreadIndex, 90.0f },
+                            { ageIndex, 45.0f }, { diffuseIndex, 60.0f }, { mixIndex, 50.0f } });
+}
+
+int DriftProcessor::storePreset(const juce::String& name)
+{
+    const int index = presets_.store(name, captureSnapshot());
+    currentProgram_ = index;
+    updateHostDisplay(juce::AudioProcessorListener::ChangeDetails().withProgramChanged(true));
+    return index;
+}
+
+bool DriftProcessor::recallPreset(int index)
+{
+    const auto* snapshot = presets_.getSnapshot(index);
+    if (snapshot == nullptr)
+        return false;
 
-    pluginId_ = parsed.getProperty("pluginId", "").toString();
-    apiBaseUrl_ = parsed.getProperty("apiBaseUrl", "").toString();
-    supabaseKey_ = parsed.getProperty("supabasePublishableKey", "").toString();
-    buildFlags_ = parsed.getProperty("flags", juce::var());
+    applySnapshot(*snapshot);
+    currentProgram_ = index;
+    updateHostDisplay(juce::AudioProcessorListener::ChangeDetails().withProgramChanged(true));
+    return true;
+}
+
+void DriftProcessor::changeProgramName(int index, const juce::String& newName)
+{
+    if (presets_.rename(index, newName))
+        updateHostDisplay(juce::AudioProcessorListener::ChangeDetails().withProgramChanged(true));
+}
 
-    DBG("Loaded project data - pluginId: " + pluginId_);
+void DriftProcessor::applySnapshot(const PluginState::Snapshot& snapshot)
+{
+    const juce::ScopedLock lock(snapshotLock_);
 
-#if BEATCONNECT_ACTIVATION_ENABLED
-    bool enableActivation = static_cast<bool>(buildFlags_.getProperty("enableActivationKeys", false));
+    // Nothing is held between calls, so the audio thread can at most be finishing a
+    // copy of the previous slot
+    auto* slot = inUseSnapshot_.load() == &snapshotSlots_[0] ? &snapshotSlots_[1] : &snapshotSlots_[0];
+    slot->values = snapshot.values;
+    heldSnapshot_.store(slot);
 
-    if (enableActivation && pluginId_.isNotEmpty())
+    for (size_t i = 0; i < parameters_.size(); ++i)
     {
-        beatconnect::ActivationConfig config;
-        config.apiBaseUrl = apiBaseUrl_.toStdString();
-        config.pluginId = pluginId_.toStdString();
-        config.supabaseKey = supabaseKey_.toStdString();
-        config.validateOnStartup = true;
-        config.revalidateIntervalSeconds = 86400; // Daily revalidation
-
-        activation_ = beatconnect::Activation::create(config);
-        DBG("Activation system configured");
+        auto* param = parameters_[i];
+        const float normalised = param->convertTo0to1(snapshot.values[i]);
+        if (param->getValue() != normalised)
+            param->setValueNotifyingHost(normalised);
     }
-#endif
-#endif
+
+    // The parameters now hold the same values
+    heldSnapshot_.store(nullptr);
+}
+
+bool DriftProcessor::readHeldSnapshot(RawParameters& raw) noexcept
+{
+    const auto* slot = heldSnapshot_.load();
+    if (slot == nullptr)
+        return false;
+
+    // Only read a slot that was still held after marking it, so the writer can't be
+    // refilling it
+    inUseSnapshot_.store(slot);
+    const bool held = heldSnapshot_.load() == slot;
+    if (held)
+        raw = slot->values;
+    inUseSnapshot_.store(nullptr);
+
+    return held;
+}
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
+{
+    return new DriftProcessor();
 }
 
+// ==============================================================================
+// BeatConnect Integration
+// ==============================================================================
+
 bool DriftProcessor::hasActivationEnabled() const
 {
 #if HAS_PROJECT_DATA && BEATCONNECT_ACTIVATION_ENABLED
-    return static_cast<bool>(buildFlags_.getProperty("enableActivationKeys", false));
+    return ProjectInfo::get().enableActivation && ProjectInfo::get().pluginId.isNotEmpty();
 #else
     return false;
 #endif
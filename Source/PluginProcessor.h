@@ -3,12 +3,29 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include <array>
+#include "ActivationService.h"
+#include "DspKernels.h"
+#include "ParameterIDs.h"
+#include "PluginState.h"
+#include "PresetBank.h"
+#include "QualityGovernor.h"
+#include "RealtimeSafety.h"
+#include "SessionCapture.h"
+#include "SpectrumAnalyzer.h"
+#include "StageProfiler.h"
 
-#if BEATCONNECT_ACTIVATION_ENABLED
-#include <beatconnect/Activation.h>
+#ifndef DRIFT_HEADLESS
+ #define DRIFT_HEADLESS 0
+#endif
+
+#if DRIFT_CLAP
+ #include <clap-juce-extensions/clap-juce-extensions.h>
 #endif
 
 class DriftProcessor : public juce::AudioProcessor
+#if DRIFT_CLAP
+                     , public clap_juce_extensions::clap_juce_audio_processor_capabilities
+#endif
 {
 public:
     DriftProcessor();
@@ -17,10 +34,10 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
     bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
-    void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) DRIFT_NONBLOCKING override;
 
     juce::AudioProcessorEditor* createEditor() override;
-    bool hasEditor() const override { return true; }
+    bool hasEditor() const override { return ! DRIFT_HEADLESS; }
 
     const juce::String getName() const override { return JucePlugin_Name; }
     bool acceptsMidi() const override { return false; }
@@ -28,22 +45,39 @@ public:
     bool isMidiEffect() const override { return false; }
     double getTailLengthSeconds() const override { return 4.0; }
 
-    int getNumPrograms() override { return 1; }
-    int getCurrentProgram() override { return 0; }
-    void setCurrentProgram(int) override {}
-    const juce::String getProgramName(int) override { return {}; }
-    void changeProgramName(int, const juce::String&) override {}
+    // Programs are the preset bank, factory presets first
+    int getNumPrograms() override { return juce::jmax(1, presets_.getNumPresets()); }
+    int getCurrentProgram() override { return currentProgram_; }
+    void setCurrentProgram(int index) override { recallPreset(index); }
+    const juce::String getProgramName(int index) override { return presets_.getName(index); }
+    void changeProgramName(int index, const juce::String& newName) override;
 
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
     juce::AudioProcessorValueTreeState& getAPVTS() { return apvts_; }
 
+    // Parameter snapshots (message thread). applySnapshot has set every parameter
+    // by the time it returns, and the audio thread switches to all of them at the
+    // same block boundary.
+    PluginState::Snapshot captureSnapshot() const;
+    PluginState::Snapshot getDefaultSnapshot() const;
+    void applySnapshot(const PluginState::Snapshot& snapshot);
+
+    // In-memory presets (message thread), also exposed to the host as programs
+    PresetBank& getPresetBank() { return presets_; }
+    int storePreset(const juce::String& name);
+    bool recallPreset(int index);
+
     // BeatConnect integration
     bool hasActivationEnabled() const;
 
+    // Shared by all instances; nullptr when activation is disabled
+    ActivationService* getActivationService() { return activationService_ != nullptr ? &activationService_->get() : nullptr; }
+
 #if BEATCONNECT_ACTIVATION_ENABLED
-    beatconnect::Activation* getActivation() { return activation_.get(); }
+    // nullptr until the shared background validation has finished
+    beatconnect::Activation* getActivation() { return activationService_ != nullptr ? (*activationService_)->getActivation() : nullptr; }
 #endif
 
     // Visualizer data
@@ -53,24 +87,88 @@ public:
     std::atomic<float> tap2Level{ 0.0f };
     std::atomic<float> tap3Level{ 0.0f };
     std::atomic<float> tap4Level{ 0.0f };
+    std::atomic<int> qualityTier{ 0 };
+
+    QualityGovernor& getQualityGovernor() { return governor_; }
+    const StageProfiler& getStageProfiler() const { return profiler_; }
+
+    // Dry vs wet spectra for the editor; only runs while enabled (see SpectrumAnalyzer.h)
+    SpectrumAnalyzer& getSpectrumAnalyzer() { return analyzer_; }
+
+    // Session capture for offline replay (see SessionCapture.h). Also started
+    // automatically when DRIFT_CAPTURE_DIR is set.
+    bool startSessionCapture(const juce::File& file);
+    void stopSessionCapture();
+    const SessionCapture& getSessionCapture() const { return capture_; }
+
+    // Audio thread: applies a parameter change (in parameter units) at a sample
+    // offset into the next processBlock. Used by CLAP events and session replay.
+    void queueParamEvent(int sampleOffset, int index, float value) noexcept DRIFT_NONBLOCKING;
+
+#if DRIFT_CLAP
+    // CLAP parameter events arrive here with their sample offsets instead of being
+    // flattened to block-start values by the wrapper
+    bool supportsDirectEvent(uint16_t spaceId, uint16_t type) override;
+    void handleDirectEvent(const clap_event_header_t* event, int sampleOffset) override;
+#endif
 
 private:
     juce::AudioProcessorValueTreeState apvts_;
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
-    void loadProjectData();
 
-    static constexpr int kStateVersion = 6;
+    // Looked up once so processBlock never does string lookups. processBlock reads
+    // the parameters' own values rather than the APVTS raw values, because the audio
+    // thread changes them with a plain setValue (see setParameterFromAudioThread).
+    std::array<juce::RangedAudioParameter*, ParameterIDs::numParameters> parameters_{};
+
+    // Parameter changes that land part-way through the next block (audio thread only).
+    // Values are in parameter units, offsets relative to the start of the block.
+    struct ParamEvent
+    {
+        int sampleOffset;
+        int index;
+        float value;
+    };
+    static constexpr int kMaxParamEvents = 256;
+    std::array<ParamEvent, kMaxParamEvents> pendingParamEvents_{};
+    int numPendingParamEvents_ = 0;
 
-    // BeatConnect data
-    juce::String pluginId_;
-    juce::String apiBaseUrl_;
-    juce::String supabaseKey_;
-    juce::var buildFlags_;
+    // Audio thread: updates a parameter without notifying its listeners, which would
+    // lock and send the host back the value it just sent. The editor polls for these.
+    void setParameterFromAudioThread(int index, float value) noexcept;
 
-#if BEATCONNECT_ACTIVATION_ENABLED
-    std::unique_ptr<beatconnect::Activation> activation_;
+    SpectrumAnalyzer analyzer_;
+
+    // Session capture state (audio thread)
+    SessionCapture capture_;
+    int captureSequence_ = 0;
+
+#if DRIFT_CLAP
+    std::array<clap_id, ParameterIDs::numParameters> clapParamIds_{};
 #endif
 
+    // Whole-snapshot parameter restore. applySnapshot sets the parameters on the
+    // calling thread; while it does, processBlock takes the snapshot's values from
+    // the held slot instead, so the DSP switches every parameter at one block
+    // boundary. The audio thread marks the slot it is copying as in use, and the
+    // writer always fills the other one.
+    struct SnapshotSlot
+    {
+        std::array<float, ParameterIDs::numParameters> values{};
+    };
+    std::array<SnapshotSlot, 2> snapshotSlots_{};
+    std::atomic<const SnapshotSlot*> heldSnapshot_{ nullptr };
+    std::atomic<const SnapshotSlot*> inUseSnapshot_{ nullptr };
+    juce::CriticalSection snapshotLock_;  // Serialises applySnapshot callers
+
+    PresetBank presets_;
+    int currentProgram_ = 0;
+
+    void addFactoryPresets();
+
+    // BeatConnect activation, shared across instances
+    std::unique_ptr<juce::SharedResourcePointer<ActivationService>> activationService_;
+
     // Musical divisions in beats (relative to quarter note)
     static constexpr std::array<float, 12> kDivisionBeats = {
         4.0f,    // 1/1
@@ -122,6 +220,15 @@ private:
     float driftPhase2_ = 0.0f;
     float driftPhase3_ = 0.0f;
 
+    // Drift LFO output, interpolated between control-rate updates
+    float driftAmount_ = 0.0f;
+    float driftStep_ = 0.0f;
+    int controlCountdown_ = 0;
+
+    // Adaptive quality (see QualityGovernor.h), with tier changes crossfaded
+    QualityGovernor governor_;
+    static constexpr double kQualityCrossfadeSeconds = 0.05;
+
     // Age filter state per tap (for progressive darkening)
     std::array<float, 4> ageFilterStateL_{};
     std::array<float, 4> ageFilterStateR_{};
@@ -131,12 +238,112 @@ private:
     std::array<float, kNumAllpasses> allpassStateL_{};
     std::array<float, kNumAllpasses> allpassStateR_{};
     static constexpr std::array<int, kNumAllpasses> kAllpassDelays = { 113, 199, 421, 677 }; // Prime numbers for diffusion
-    std::array<std::array<float, 1024>, kNumAllpasses> allpassBufferL_{};
-    std::array<std::array<float, 1024>, kNumAllpasses> allpassBufferR_{};
-    std::array<int, kNumAllpasses> allpassWritePos_{};
+    static constexpr int kAllpassBufferSize = 1024;
+    std::array<std::array<float, kAllpassBufferSize>, kNumAllpasses> allpassBufferL_{};
+    std::array<std::array<float, kAllpassBufferSize>, kNumAllpasses> allpassBufferR_{};
+    std::array<int, kNumAllpasses> allpassWritePosL_{};
+    std::array<int, kNumAllpasses> allpassWritePosR_{};
+    std::array<juce::SmoothedValue<float>, kNumAllpasses> diffusionBlend_;
+    juce::SmoothedValue<float> lpBlend_;
+
+    // DSP kernels for this CPU (see DspKernels.h)
+    const DriftKernels::KernelTable* kernels_ = &DriftKernels::get();
+
+    // The engine is a pipeline of stages (see renderRange), each processing a whole
+    // chunk into the buffers below. Chunks are as long as the host block, but shorter
+    // than the shortest delay the drift LFOs can reach, so every delay-line read in a
+    // chunk lands before the feedback stage writes it.
+    static constexpr int kMaxTaps = 4;
+    static constexpr int kMinChunkCapacity = 64;
+    static constexpr int kMaxChunkCapacity = 4096;
+    static constexpr float kMinDriftMod = 0.92f; // Shortest the drift LFOs make the base delay
+    static_assert(kNumAllpasses >= kMaxTaps, "Each tap needs its own allpass");
+
+    struct StageBuffers
+    {
+        // Message thread (constructor / prepareToPlay)
+        void allocate(int maxChunk);
+
+        int maxChunkSize = 0;
+        std::vector<float> storage;
+
+        // Control
+        float* duckGain = nullptr;
+        float* baseSamples = nullptr;
+        float* drift = nullptr;
+        float* feedback = nullptr;
+        float* mix = nullptr;
+        float* spread = nullptr;
+        float* grit = nullptr;
+        float* age = nullptr;
+        float* diffuse = nullptr;
+
+        // Per-stage scratch
+        float* readPos = nullptr;
+        float* tapGrit = nullptr;
+        float* tapAmp = nullptr;
+        float* gainL = nullptr;
+        float* gainR = nullptr;
+        float* coeff = nullptr;
+        float* preDiffuseL = nullptr;
+        float* preDiffuseR = nullptr;
+        float* fbL = nullptr;
+        float* fbR = nullptr;
+        float* fbGrit = nullptr;
+
+        // Stage outputs
+        std::array<float*, kMaxTaps> tapL{};
+        std::array<float*, kMaxTaps> tapR{};
+        float* wetL = nullptr;
+        float* wetR = nullptr;
+    };
+    StageBuffers stages_;
+    StageProfiler profiler_;
+
+    // Per-range values shared by the stages
+    struct StageSettings
+    {
+        const QualityGovernor::Tier* tier = nullptr;
+        int numTaps = 1;
+        float duckPct = 0.0f;
+        float duckAttack = 0.0f;
+        float duckRelease = 0.0f;
+        float driftRate1 = 0.0f;
+        float driftRate2 = 0.0f;
+        float driftRate3 = 0.0f;
+    };
+
+    // Progressive character per tap (later taps get more character)
+    static float getTapCharacter(int tap) { return 0.25f + (static_cast<float>(tap) / 3.0f) * 0.75f; }
+
+    using RawParameters = std::array<float, ParameterIDs::numParameters>;
+
+    // Copies the snapshot applySnapshot is in the middle of setting, if any
+    bool readHeldSnapshot(RawParameters& raw) noexcept DRIFT_NONBLOCKING;
+
+    struct BlockMeters
+    {
+        float peakIn = 0.0f;
+        float driftViz = 0.0f;
+        std::array<float, 4> tapLevels{};
+    };
+
+    double getHostBpm() const;
+    void captureBlock(const juce::AudioBuffer<float>& buffer, const RawParameters& raw, double bpm) DRIFT_NONBLOCKING;
+
+    // Renders [begin, end) of the buffer with one set of parameter targets
+    void renderRange(juce::AudioBuffer<float>& buffer, int begin, int end,
+                     const RawParameters& raw, double bpm, BlockMeters& meters) DRIFT_NONBLOCKING;
+
+    void runControlStage(const float* dryL, const float* dryR, int n,
+                         const StageSettings& settings, BlockMeters& meters) DRIFT_NONBLOCKING;
+    void runTapReadStage(int n, const StageSettings& settings) DRIFT_NONBLOCKING;
+    void runDiffusionStage(int n, const StageSettings& settings) DRIFT_NONBLOCKING;
+    void runTapSumStage(int n, const StageSettings& settings, BlockMeters& meters) DRIFT_NONBLOCKING;
+    void runWetFilterStage(int n) DRIFT_NONBLOCKING;
+    void runFeedbackStage(const float* dryL, const float* dryR, int n) DRIFT_NONBLOCKING;
 
-    float readDelayInterp(const std::array<float, kDelayBufferSize>& buffer, float delaySamples) const;
-    float processSaturation(float input, float amount) const;
+    float getDelayReadPosition(int offset, float delaySamples) const;
     float processAllpass(float input, int index, bool isLeft, float coeff);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DriftProcessor)
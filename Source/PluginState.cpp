@@ -0,0 +1,90 @@
+#include "PluginState.h"
+
+namespace
+{
+    constexpr juce::uint32 kMagic = 0x53465244; // "DRFS"
+    constexpr int kHeaderSize = 12;
+
+    bool readBinary(const void* data, int sizeInBytes, PluginState::Snapshot& snapshot)
+    {
+        if (sizeInBytes < kHeaderSize || juce::ByteOrder::littleEndianInt(data) != kMagic)
+            return false;
+
+        juce::MemoryInputStream stream(data, static_cast<size_t>(sizeInBytes), false);
+        stream.skipNextBytes(4);
+
+        const int version = stream.readInt();
+        const int numValues = stream.readInt();
+
+        if (version < PluginState::kFirstBinaryVersion || numValues < 0
+            || numValues > (sizeInBytes - kHeaderSize) / static_cast<int>(sizeof(float)))
+            return false;
+
+        // Newer states may carry parameters this build doesn't know; they were appended
+        PluginState::Snapshot read = snapshot;
+        const int numKnown = juce::jmin(numValues, static_cast<int>(ParameterIDs::numParameters));
+        for (int i = 0; i < numKnown; ++i)
+            read.values[static_cast<size_t>(i)] = stream.readFloat();
+
+        PluginState::migrate(read, version);
+        snapshot = read;
+        return true;
+    }
+
+    bool readXml(const void* data, int sizeInBytes, PluginState::Snapshot& snapshot)
+    {
+        std::unique_ptr<juce::XmlElement> xml(juce::AudioProcessor::getXmlFromBinary(data, sizeInBytes));
+        if (xml == nullptr || ! xml->hasTagName("Parameters"))
+            return false;
+
+        PluginState::Snapshot read = snapshot;
+        for (auto* param : xml->getChildWithTagNameIterator("PARAM"))
+        {
+            const auto id = param->getStringAttribute("id");
+            for (size_t i = 0; i < ParameterIDs::all.size(); ++i)
+            {
+                if (id == ParameterIDs::all[i])
+                {
+                    read.values[i] = static_cast<float>(param->getDoubleAttribute("value", read.values[i]));
+                    break;
+                }
+            }
+        }
+
+        PluginState::migrate(read, xml->getIntAttribute("stateVersion", 0));
+        snapshot = read;
+        return true;
+    }
+}
+
+namespace PluginState
+{
+    void write(const Snapshot& snapshot, juce::MemoryBlock& destData)
+    {
+        destData.setSize(0);
+        juce::MemoryOutputStream stream(destData, false);
+
+        stream.writeInt(static_cast<int>(kMagic));
+        stream.writeInt(kStateVersion);
+        stream.writeInt(static_cast<int>(snapshot.values.size()));
+
+        for (const float value : snapshot.values)
+            stream.writeFloat(value);
+    }
+
+    bool read(const void* data, int sizeInBytes, Snapshot& snapshot)
+    {
+        if (data == nullptr || sizeInBytes <= 0)
+            return false;
+
+        return readBinary(data, sizeInBytes, snapshot) || readXml(data, sizeInBytes, snapshot);
+    }
+
+    void migrate(Snapshot& snapshot, int fromVersion)
+    {
+        // One step per version bump, oldest first, so a state from any release walks
+        // forward to kStateVersion. Versions up to 7 share today's parameters and
+        // ranges, and XML states are keyed by parameter ID, so nothing converts yet.
+        juce::ignoreUnused(snapshot, fromVersion);
+    }
+}
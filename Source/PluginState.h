@@ -0,0 +1,40 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+#include "ParameterIDs.h"
+
+// Plugin state in a compact binary layout, replacing the APVTS ValueTree -> XML
+// round trip on every session save and load.
+//
+// Layout (little-endian): the magic "DRFS", int32 version, int32 value count, then
+// one float per parameter holding its plain (unnormalised) value in ParameterIDs
+// order - 56 bytes for today's 11 parameters. New parameters are only ever appended.
+// Any other change to a parameter's position, range or meaning bumps kStateVersion
+// and adds a step to migrate(), so sessions from every release load unchanged.
+//
+// States saved before version 7 are APVTS XML blobs; read() still accepts those.
+namespace PluginState
+{
+    inline constexpr int kStateVersion = 7;
+
+    // Oldest version written in the binary layout, everything before it is XML
+    inline constexpr int kFirstBinaryVersion = 7;
+
+    // Plain parameter values in ParameterIDs order
+    struct Snapshot
+    {
+        std::array<float, ParameterIDs::numParameters> values{};
+    };
+
+    void write(const Snapshot& snapshot, juce::MemoryBlock& destData);
+
+    // Parses a binary or legacy XML state into snapshot and migrates it to
+    // kStateVersion. Parameters the state doesn't contain keep the value snapshot
+    // already holds. Returns false, leaving snapshot untouched, if the data isn't a
+    // DRIFT state.
+    bool read(const void* data, int sizeInBytes, Snapshot& snapshot);
+
+    // Converts a snapshot read from an older state version to kStateVersion
+    void migrate(Snapshot& snapshot, int fromVersion);
+}
@@ -0,0 +1,54 @@
+#include "PresetBank.h"
+
+juce::String PresetBank::getName(int index) const
+{
+    return juce::isPositiveAndBelow(index, getNumPresets()) ? presets_[static_cast<size_t>(index)].name
+                                                            : juce::String();
+}
+
+int PresetBank::indexOf(const juce::String& name) const
+{
+    for (size_t i = 0; i < presets_.size(); ++i)
+        if (presets_[i].name == name)
+            return static_cast<int>(i);
+
+    return -1;
+}
+
+const PluginState::Snapshot* PresetBank::getSnapshot(int index) const noexcept
+{
+    return juce::isPositiveAndBelow(index, getNumPresets()) ? &presets_[static_cast<size_t>(index)].snapshot
+                                                            : nullptr;
+}
+
+int PresetBank::store(const juce::String& name, const PluginState::Snapshot& snapshot)
+{
+    const int existing = indexOf(name);
+    if (existing >= 0)
+    {
+        presets_[static_cast<size_t>(existing)].snapshot = snapshot;
+        return existing;
+    }
+
+    presets_.push_back({ name, snapshot });
+    return getNumPresets() - 1;
+}
+
+void PresetBank::remove(int index)
+{
+    if (juce::isPositiveAndBelow(index, getNumPresets()))
+        presets_.erase(presets_.begin() + index);
+}
+
+bool PresetBank::rename(int index, const juce::String& name)
+{
+    if (! juce::isPositiveAndBelow(index, getNumPresets()) || name.isEmpty())
+        return false;
+
+    const int existing = indexOf(name);
+    if (existing >= 0 && existing != index)
+        return false;
+
+    presets_[static_cast<size_t>(index)].name = name;
+    return true;
+}
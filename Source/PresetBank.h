@@ -0,0 +1,39 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <vector>
+#include "PluginState.h"
+
+// Named parameter snapshots held in memory for instant recall.
+//
+// Presets are built once and recalled by index, and DriftProcessor exposes them
+// to the host as its programs. Switching never rebuilds the ValueTree:
+// DriftProcessor::recallPreset applies the stored snapshot, which the audio thread
+// picks up whole at the next block boundary.
+// Message thread only.
+class PresetBank
+{
+public:
+    int getNumPresets() const noexcept { return static_cast<int>(presets_.size()); }
+    juce::String getName(int index) const;
+    int indexOf(const juce::String& name) const;
+
+    // nullptr if index is out of range
+    const PluginState::Snapshot* getSnapshot(int index) const noexcept;
+
+    // Adds a preset, or replaces the one with the same name. Returns its index.
+    int store(const juce::String& name, const PluginState::Snapshot& snapshot);
+    void remove(int index);
+
+    // Fails if index is out of range or another preset already has the name
+    bool rename(int index, const juce::String& name);
+
+private:
+    struct Preset
+    {
+        juce::String name;
+        PluginState::Snapshot snapshot;
+    };
+
+    std::vector<Preset> presets_;
+};
@@ -0,0 +1,48 @@
+#include "ProjectInfo.h"
+
+#if HAS_PROJECT_DATA
+#include "ProjectData.h"
+#endif
+
+namespace
+{
+    ProjectInfo parseProjectData()
+    {
+        ProjectInfo info;
+
+#if HAS_PROJECT_DATA
+        int dataSize = 0;
+        const char* data = ProjectData::getNamedResource("project_data_json", dataSize);
+
+        if (data == nullptr || dataSize == 0)
+        {
+            DBG("No project_data.json found in binary data");
+            return info;
+        }
+
+        auto parsed = juce::JSON::parse(juce::String::fromUTF8(data, dataSize));
+        if (parsed.isVoid())
+        {
+            DBG("Failed to parse project_data.json");
+            return info;
+        }
+
+        info.pluginId = parsed.getProperty("pluginId", "").toString();
+        info.apiBaseUrl = parsed.getProperty("apiBaseUrl", "").toString();
+        info.supabaseKey = parsed.getProperty("supabasePublishableKey", "").toString();
+        info.activationPublicKey = parsed.getProperty("activationPublicKey", "").toString();
+        info.buildFlags = parsed.getProperty("flags", juce::var());
+        info.enableActivation = static_cast<bool>(info.buildFlags.getProperty("enableActivationKeys", false));
+
+        DBG("Loaded project data - pluginId: " + info.pluginId);
+#endif
+
+        return info;
+    }
+}
+
+const ProjectInfo& ProjectInfo::get()
+{
+    static const ProjectInfo info = parseProjectData();
+    return info;
+}
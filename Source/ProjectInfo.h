@@ -0,0 +1,18 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+// BeatConnect project data from the embedded project_data.json. Parsed once per
+// process on first use and shared by every DRIFT instance.
+struct ProjectInfo
+{
+    juce::String pluginId;
+    juce::String apiBaseUrl;
+    juce::String supabaseKey;
+    juce::String activationPublicKey;  // juce::RSAKey string, verifies cached activation tokens
+    juce::var buildFlags;
+
+    bool enableActivation = false;
+
+    static const ProjectInfo& get();
+};
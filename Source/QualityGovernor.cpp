@@ -0,0 +1,114 @@
+#include "QualityGovernor.h"
+
+namespace
+{
+    const QualityGovernor::Tier kTiers[QualityGovernor::kNumTiers] = {
+        { "full",     1,  4, true  },
+        { "reduced",  8,  4, true  },
+        { "economy",  32, 2, true  },
+        { "minimum",  64, 0, false }
+    };
+}
+
+const QualityGovernor::Tier& QualityGovernor::getTier(int index)
+{
+    return kTiers[juce::jlimit(0, kNumTiers - 1, index)];
+}
+
+void QualityGovernor::prepare(double sampleRate)
+{
+    sampleRate_ = sampleRate > 0.0 ? sampleRate : 44100.0;
+    ticksPerSecond_ = static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+    reset();
+}
+
+void QualityGovernor::reset()
+{
+    load_ = 0.0f;
+    overloadedSeconds_ = 0.0;
+    idleSeconds_ = 0.0;
+    reportedLoad_.store(0.0f, std::memory_order_relaxed);
+
+    currentTier_.store(getPinnedTier(), std::memory_order_relaxed);
+}
+
+void QualityGovernor::setForcedTier(int tier) noexcept
+{
+    const int forced = tier < 0 ? -1 : juce::jmin(tier, kNumTiers - 1);
+    forcedTier_.store(forced, std::memory_order_relaxed);
+
+    // Takes effect from the next block rather than after it
+    if (forced >= 0)
+        currentTier_.store(forced, std::memory_order_relaxed);
+}
+
+void QualityGovernor::setNonRealtime(bool isNonRealtime) noexcept
+{
+    if (nonRealtime_.exchange(isNonRealtime, std::memory_order_relaxed) == isNonRealtime)
+        return;
+
+    // Start from full quality either way: an offline pass never steps down, and a
+    // realtime one re-measures its own load rather than inheriting the bounce's
+    overloadedSeconds_ = 0.0;
+    idleSeconds_ = 0.0;
+    currentTier_.store(getPinnedTier(), std::memory_order_relaxed);
+}
+
+int QualityGovernor::getPinnedTier() const noexcept
+{
+    const int forced = forcedTier_.load(std::memory_order_relaxed);
+    return forced >= 0 ? forced : 0;
+}
+
+void QualityGovernor::endBlock(juce::int64 startTicks, int numSamples) noexcept
+{
+    if (numSamples <= 0)
+        return;
+
+    const double budgetSeconds = numSamples / sampleRate_;
+    const double elapsedSeconds = static_cast<double>(juce::Time::getHighResolutionTicks() - startTicks) / ticksPerSecond_;
+    const float blockLoad = static_cast<float>(elapsedSeconds / budgetSeconds);
+
+    // Fast attack, slow release so spikes register immediately
+    const float coeff = blockLoad > load_ ? 0.5f : 0.05f;
+    load_ += coeff * (blockLoad - load_);
+    reportedLoad_.store(load_, std::memory_order_relaxed);
+
+    if (forcedTier_.load(std::memory_order_relaxed) >= 0 || nonRealtime_.load(std::memory_order_relaxed))
+    {
+        currentTier_.store(getPinnedTier(), std::memory_order_relaxed);
+        return;
+    }
+
+    int tier = currentTier_.load(std::memory_order_relaxed);
+
+    if (load_ > kStepDownLoad)
+    {
+        idleSeconds_ = 0.0;
+        overloadedSeconds_ += budgetSeconds;
+
+        if (overloadedSeconds_ >= kStepDownHoldSeconds && tier < kNumTiers - 1)
+        {
+            ++tier;
+            overloadedSeconds_ = 0.0;
+        }
+    }
+    else if (load_ < kStepUpLoad)
+    {
+        overloadedSeconds_ = 0.0;
+        idleSeconds_ += budgetSeconds;
+
+        if (idleSeconds_ >= kStepUpHoldSeconds && tier > 0)
+        {
+            --tier;
+            idleSeconds_ = 0.0;
+        }
+    }
+    else
+    {
+        overloadedSeconds_ = 0.0;
+        idleSeconds_ = 0.0;
+    }
+
+    currentTier_.store(tier, std::memory_order_relaxed);
+}
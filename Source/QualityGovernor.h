@@ -0,0 +1,66 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <atomic>
+
+// Adaptive quality under CPU pressure.
+//
+// processBlock times itself against its real-time budget (numSamples / sampleRate)
+// and the governor steps down through the tiers below when DRIFT's share of the
+// budget stays high, and back up after a longer stretch of headroom. DRIFT already
+// uses linear interpolation and no oversampling, so the tiers trade control rate,
+// diffusion density and the wet smoothing filter instead.
+class QualityGovernor
+{
+public:
+    struct Tier
+    {
+        const char* name;
+        int controlInterval;   // Samples between drift LFO evaluations (interpolated between)
+        int diffusedTaps;      // Taps that run their allpass diffuser
+        bool smoothingFilter;  // Global 12 kHz lowpass on the wet signal
+    };
+
+    static constexpr int kNumTiers = 4;
+    static const Tier& getTier(int index);
+
+    void prepare(double sampleRate);
+    void reset();
+
+    // Audio thread
+    juce::int64 beginBlock() const noexcept { return juce::Time::getHighResolutionTicks(); }
+    void endBlock(juce::int64 startTicks, int numSamples) noexcept;
+
+    // Offline renders have no deadline, so they always get the full tier
+    void setNonRealtime(bool isNonRealtime) noexcept;
+
+    // Any thread
+    int getCurrentTier() const noexcept { return currentTier_.load(std::memory_order_relaxed); }
+    float getLoad() const noexcept { return reportedLoad_.load(std::memory_order_relaxed); }
+
+    // Pins a tier for testing, -1 returns to automatic selection
+    void setForcedTier(int tier) noexcept;
+
+private:
+    int getPinnedTier() const noexcept;
+
+    // DRIFT is one plugin among many in a session, so it backs off long before it
+    // owns the whole callback budget.
+    static constexpr float kStepDownLoad = 0.35f;
+    static constexpr float kStepUpLoad = 0.15f;
+    static constexpr double kStepDownHoldSeconds = 0.05;
+    static constexpr double kStepUpHoldSeconds = 2.0;
+
+    double sampleRate_ = 44100.0;
+    double ticksPerSecond_ = 1.0;
+
+    // Audio thread state
+    float load_ = 0.0f;
+    double overloadedSeconds_ = 0.0;
+    double idleSeconds_ = 0.0;
+
+    std::atomic<int> currentTier_{ 0 };
+    std::atomic<int> forcedTier_{ -1 };
+    std::atomic<bool> nonRealtime_{ false };
+    std::atomic<float> reportedLoad_{ 0.0f };
+};
@@ -0,0 +1,205 @@
+#include "RealtimeSafety.h"
+
+#if DRIFT_REALTIME_CHECKS && ! DRIFT_RTSAN
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+ #define DRIFT_INTERPOSE_BLOCKING_CALLS 1
+ #include <dlfcn.h>
+ #include <pthread.h>
+ #include <time.h>
+ #include <unistd.h>
+#else
+ #define DRIFT_INTERPOSE_BLOCKING_CALLS 0
+#endif
+
+// ==============================================================================
+// Audio callback scope tracking
+// ==============================================================================
+
+namespace
+{
+    thread_local int audioCallbackDepth = 0;
+
+    [[noreturn]] void reportViolation(const char* what) noexcept
+    {
+        // Reset first so nothing below recurses into the check
+        audioCallbackDepth = 0;
+        std::fprintf(stderr, "DRIFT real-time violation: %s inside processBlock\n", what);
+        std::fflush(stderr);
+        std::abort();
+    }
+
+    void* checkedAlloc(std::size_t size) noexcept
+    {
+        if (audioCallbackDepth > 0)
+            reportViolation("heap allocation");
+
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* checkedAlignedAlloc(std::size_t size, std::size_t alignment) noexcept
+    {
+        if (audioCallbackDepth > 0)
+            reportViolation("heap allocation");
+
+        if (size == 0) size = alignment;
+        size = (size + alignment - 1) / alignment * alignment;
+
+       #if defined(_WIN32)
+        return _aligned_malloc(size, alignment);
+       #else
+        return std::aligned_alloc(alignment, size);
+       #endif
+    }
+
+    void checkedFree(void* ptr) noexcept
+    {
+        if (ptr != nullptr && audioCallbackDepth > 0)
+            reportViolation("heap deallocation");
+
+        std::free(ptr);
+    }
+
+    void checkedAlignedFree(void* ptr) noexcept
+    {
+        if (ptr != nullptr && audioCallbackDepth > 0)
+            reportViolation("heap deallocation");
+
+       #if defined(_WIN32)
+        _aligned_free(ptr);
+       #else
+        std::free(ptr);
+       #endif
+    }
+
+#if DRIFT_INTERPOSE_BLOCKING_CALLS
+    // The libc function an interposed call forwards to. Cached in an atomic rather
+    // than a function-local static, whose initialisation guard may itself lock.
+    template <typename Function>
+    Function* findNext(std::atomic<void*>& cache, const char* name) noexcept
+    {
+        auto* function = cache.load(std::memory_order_relaxed);
+        if (function == nullptr)
+        {
+            function = dlsym(RTLD_NEXT, name);
+            cache.store(function, std::memory_order_relaxed);
+        }
+        return reinterpret_cast<Function*>(function);
+    }
+#endif
+
+    void* throwingAlloc(void* ptr)
+    {
+        if (ptr == nullptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+}
+
+namespace RealtimeSafety
+{
+    ScopedAudioCallback::ScopedAudioCallback() noexcept  { ++audioCallbackDepth; }
+    ScopedAudioCallback::~ScopedAudioCallback() noexcept { --audioCallbackDepth; }
+
+    ScopedAllowBlocking::ScopedAllowBlocking() noexcept
+        : savedDepth_(audioCallbackDepth)
+    {
+        audioCallbackDepth = 0;
+    }
+
+    ScopedAllowBlocking::~ScopedAllowBlocking() noexcept { audioCallbackDepth = savedDepth_; }
+
+    bool isInAudioCallback() noexcept { return audioCallbackDepth > 0; }
+}
+
+// ==============================================================================
+// Interposed global allocator
+// ==============================================================================
+
+void* operator new(std::size_t size)                                   { return throwingAlloc(checkedAlloc(size)); }
+void* operator new[](std::size_t size)                                 { return throwingAlloc(checkedAlloc(size)); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept   { return checkedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return checkedAlloc(size); }
+
+void* operator new(std::size_t size, std::align_val_t al)   { return throwingAlloc(checkedAlignedAlloc(size, static_cast<std::size_t>(al))); }
+void* operator new[](std::size_t size, std::align_val_t al) { return throwingAlloc(checkedAlignedAlloc(size, static_cast<std::size_t>(al))); }
+void* operator new(std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept   { return checkedAlignedAlloc(size, static_cast<std::size_t>(al)); }
+void* operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return checkedAlignedAlloc(size, static_cast<std::size_t>(al)); }
+
+void operator delete(void* ptr) noexcept                                  { checkedFree(ptr); }
+void operator delete[](void* ptr) noexcept                                { checkedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept                     { checkedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept                   { checkedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept           { checkedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept         { checkedFree(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept                { checkedAlignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept              { checkedAlignedFree(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept   { checkedAlignedFree(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { checkedAlignedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept   { checkedAlignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { checkedAlignedFree(ptr); }
+
+// ==============================================================================
+// Interposed locking and blocking calls
+// ==============================================================================
+
+// Hidden, so that inside a plugin binary DRIFT's own calls bind to these rather
+// than to libc's, which the host has already loaded.
+#if DRIFT_INTERPOSE_BLOCKING_CALLS
+ #define DRIFT_INTERPOSED extern "C" __attribute__((visibility("hidden")))
+
+DRIFT_INTERPOSED int pthread_mutex_lock(pthread_mutex_t* mutex)
+{
+    if (audioCallbackDepth > 0)
+        reportViolation("pthread_mutex_lock");
+
+    static std::atomic<void*> next{ nullptr };
+    return findNext<int(pthread_mutex_t*)>(next, "pthread_mutex_lock")(mutex);
+}
+
+DRIFT_INTERPOSED int nanosleep(const struct timespec* duration, struct timespec* remaining)
+{
+    if (audioCallbackDepth > 0)
+        reportViolation("nanosleep");
+
+    static std::atomic<void*> next{ nullptr };
+    return findNext<int(const struct timespec*, struct timespec*)>(next, "nanosleep")(duration, remaining);
+}
+
+DRIFT_INTERPOSED int usleep(useconds_t microseconds)
+{
+    if (audioCallbackDepth > 0)
+        reportViolation("usleep");
+
+    static std::atomic<void*> next{ nullptr };
+    return findNext<int(useconds_t)>(next, "usleep")(microseconds);
+}
+
+DRIFT_INTERPOSED ssize_t read(int fd, void* data, size_t numBytes)
+{
+    if (audioCallbackDepth > 0)
+        reportViolation("read");
+
+    static std::atomic<void*> next{ nullptr };
+    return findNext<ssize_t(int, void*, size_t)>(next, "read")(fd, data, numBytes);
+}
+
+DRIFT_INTERPOSED ssize_t write(int fd, const void* data, size_t numBytes)
+{
+    if (audioCallbackDepth > 0)
+        reportViolation("write");
+
+    static std::atomic<void*> next{ nullptr };
+    return findNext<ssize_t(int, const void*, size_t)>(next, "write")(fd, data, numBytes);
+}
+
+ #undef DRIFT_INTERPOSED
+#endif
+
+#endif
@@ -0,0 +1,72 @@
+#pragma once
+
+// Real-time safety checks for the audio callback.
+//
+// Configure with -DDRIFT_REALTIME_CHECKS=ON to make any heap allocation, lock or
+// blocking call inside processBlock abort the process with a report. When the
+// compiler supports clang's RealtimeSanitizer (-fsanitize=realtime) it is used and
+// covers allocations, mutexes and syscalls. Otherwise an interposed global
+// allocator catches heap allocations made while a ScopedAudioCallback is active,
+// and on Linux and macOS interposed pthread_mutex_lock, nanosleep, usleep, read
+// and write catch locks and blocking calls made from DRIFT's own code (which
+// includes the JUCE modules it compiles, so CriticalSection and WaitableEvent).
+// On Windows that fallback only catches allocations. Both compile to nothing in
+// regular builds.
+
+#ifndef DRIFT_REALTIME_CHECKS
+ #define DRIFT_REALTIME_CHECKS 0
+#endif
+
+#ifndef DRIFT_RTSAN
+ #define DRIFT_RTSAN 0
+#endif
+
+#if DRIFT_RTSAN
+ #include <sanitizer/rtsan_interface.h>
+ #define DRIFT_NONBLOCKING [[clang::nonblocking]]
+#else
+ #define DRIFT_NONBLOCKING
+#endif
+
+namespace RealtimeSafety
+{
+#if DRIFT_REALTIME_CHECKS && ! DRIFT_RTSAN
+    // Marks the current thread as being inside the audio callback
+    class ScopedAudioCallback
+    {
+    public:
+        ScopedAudioCallback() noexcept;
+        ~ScopedAudioCallback() noexcept;
+
+        ScopedAudioCallback(const ScopedAudioCallback&) = delete;
+        ScopedAudioCallback& operator=(const ScopedAudioCallback&) = delete;
+    };
+
+    // Temporarily allows allocations (e.g. for code that is known to be off the hot path)
+    class ScopedAllowBlocking
+    {
+    public:
+        ScopedAllowBlocking() noexcept;
+        ~ScopedAllowBlocking() noexcept;
+
+        ScopedAllowBlocking(const ScopedAllowBlocking&) = delete;
+        ScopedAllowBlocking& operator=(const ScopedAllowBlocking&) = delete;
+
+    private:
+        int savedDepth_;
+    };
+
+    bool isInAudioCallback() noexcept;
+#elif DRIFT_RTSAN
+    // RTSan tracks the nonblocking scope itself via DRIFT_NONBLOCKING
+    struct ScopedAudioCallback { ScopedAudioCallback() noexcept {} };
+    using ScopedAllowBlocking = __rtsan::ScopedDisabler;
+
+    inline bool isInAudioCallback() noexcept { return false; }
+#else
+    struct ScopedAudioCallback { ScopedAudioCallback() noexcept {} };
+    struct ScopedAllowBlocking { ScopedAllowBlocking() noexcept {} };
+
+    inline bool isInAudioCallback() noexcept { return false; }
+#endif
+}
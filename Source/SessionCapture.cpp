@@ -0,0 +1,143 @@
+#include "SessionCapture.h"
+
+SessionCapture::SessionCapture()
+    : juce::Thread("DRIFT Session Capture")
+{
+}
+
+SessionCapture::~SessionCapture()
+{
+    stop();
+}
+
+bool SessionCapture::start(const juce::File& file, const juce::StringArray& parameterIds,
+                           double sampleRate, int maxBlockSize)
+{
+    stop();
+
+    file.getParentDirectory().createDirectory();
+    auto stream = std::make_unique<juce::FileOutputStream>(file);
+    if (! stream->openedOk() || ! stream->setPosition(0) || stream->truncate().failed())
+        return false;
+
+    stream->write("DCAP", 4);
+    stream->writeInt(kFormatVersion);
+    stream->writeInt(parameterIds.size());
+    for (const auto& id : parameterIds)
+        stream->writeString(id);
+
+    if (sampleRate > 0.0)
+    {
+        stream->writeByte(static_cast<char>(prepareRecord));
+        stream->writeDouble(sampleRate);
+        stream->writeInt(maxBlockSize);
+    }
+
+    if (buffer_ == nullptr)
+        buffer_.allocate(kBufferBytes, false);
+
+    fifo_ = std::make_unique<juce::AbstractFifo>(kBufferBytes);
+    stream_ = std::move(stream);
+    file_ = file;
+    dropped_.store(0, std::memory_order_relaxed);
+
+    startThread(juce::Thread::Priority::low);
+    active_.store(true, std::memory_order_release);
+    return true;
+}
+
+void SessionCapture::stop()
+{
+    if (! active_.exchange(false) && stream_ == nullptr)
+        return;
+
+    // Let a record the audio thread is still writing land before the final drain
+    while (recordsInFlight_.load() > 0)
+        juce::Thread::yield();
+
+    stopThread(1000);
+    drain();
+
+    stream_->flush();
+    stream_.reset();
+}
+
+SessionCapture::Record SessionCapture::beginRecord(int numBytes) noexcept
+{
+    return Record(*this, numBytes);
+}
+
+void SessionCapture::run()
+{
+    while (! threadShouldExit())
+    {
+        drain();
+        wait(20);
+    }
+}
+
+void SessionCapture::drain()
+{
+    if (fifo_ == nullptr || stream_ == nullptr)
+        return;
+
+    const auto scope = fifo_->read(fifo_->getNumReady());
+
+    if (scope.blockSize1 > 0)
+        stream_->write(buffer_ + scope.startIndex1, static_cast<size_t>(scope.blockSize1));
+    if (scope.blockSize2 > 0)
+        stream_->write(buffer_ + scope.startIndex2, static_cast<size_t>(scope.blockSize2));
+}
+
+// ==============================================================================
+// Record
+// ==============================================================================
+
+SessionCapture::Record::Record(SessionCapture& owner, int size) noexcept
+    : owner_(owner)
+{
+    owner_.recordsInFlight_.fetch_add(1);
+
+    // Sequentially consistent with stop(): either stop() waits for this record, or
+    // this record sees capture is off
+    if (! owner_.active_.load() || owner_.fifo_ == nullptr)
+        return;
+
+    if (owner_.fifo_->getFreeSpace() < size)
+    {
+        owner_.dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    owner_.fifo_->prepareToWrite(size, start1_, size1_, start2_, size2_);
+    size_ = size;
+}
+
+SessionCapture::Record::~Record() noexcept
+{
+    if (size_ > 0)
+        owner_.fifo_->finishedWrite(size_);
+
+    owner_.recordsInFlight_.fetch_sub(1);
+}
+
+void SessionCapture::Record::writeBytes(const void* data, int numBytes) noexcept
+{
+    numBytes = juce::jmin(numBytes, size_ - written_);
+    auto* source = static_cast<const char*>(data);
+
+    while (numBytes > 0)
+    {
+        const bool inFirst = written_ < size1_;
+        const int regionOffset = inFirst ? written_ : written_ - size1_;
+        const int regionStart = inFirst ? start1_ : start2_;
+        const int regionSize = inFirst ? size1_ : size2_;
+        const int len = juce::jmin(numBytes, regionSize - regionOffset);
+
+        std::memcpy(owner_.buffer_ + regionStart + regionOffset, source, static_cast<size_t>(len));
+
+        source += len;
+        written_ += len;
+        numBytes -= len;
+    }
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+// Records what the host feeds processBlock so a session can be replayed offline
+// (see Tools/DriftReplay.cpp).
+//
+// The audio thread appends records to a preallocated lock-free ring. A background
+// thread drains the ring into the capture file. When the ring is full the record is
+// dropped and counted rather than blocking the audio thread; block records carry a
+// sequence number, so the replay tool can report the gap.
+//
+// File layout (all values little-endian):
+//   header:  "DCAP", int32 version, int32 numParameters, numParameters
+//            null-terminated parameter IDs
+//   records: uint8 type, then
+//     prepareRecord: float64 sampleRate, int32 maxBlockSize
+//     blockRecord:   int32 sequence, int32 numSamples, int32 numChannels,
+//                    float64 bpm, int32 qualityTier,
+//                    float32[numParameters] raw parameter values at block start,
+//                    int32 numEvents, { int32 sampleOffset, int32 index, float32 value }[numEvents],
+//                    float32[numChannels][numSamples] input audio
+class SessionCapture : private juce::Thread
+{
+public:
+    static constexpr juce::int32 kFormatVersion = 1;
+
+    enum RecordType : juce::uint8
+    {
+        prepareRecord = 1,
+        blockRecord = 2
+    };
+
+    SessionCapture();
+    ~SessionCapture() override;
+
+    // Message thread. Opens the file, writes the header and starts the writer. When
+    // the processor is already prepared, pass its sample rate and block size: the
+    // prepare record then goes into the file before capture turns on, so the audio
+    // thread stays the ring's only producer.
+    bool start(const juce::File& file, const juce::StringArray& parameterIds,
+               double sampleRate = 0.0, int maxBlockSize = 0);
+    void stop();
+
+    bool isActive() const noexcept { return active_.load(std::memory_order_acquire); }
+    int getNumDroppedRecords() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+    juce::File getFile() const { return file_; }
+
+    // One record, written in place into the ring. Writes past the reserved size
+    // are ignored; the record is committed when it goes out of scope.
+    class Record
+    {
+    public:
+        ~Record() noexcept;
+
+        bool isValid() const noexcept { return size_ > 0; }
+
+        // Values are stored little-endian whatever the host byte order, as the
+        // file layout promises and DriftReplay's readInt/readFloat expect.
+        template <typename Type>
+        void write(Type value) noexcept
+        {
+            static_assert(std::is_arithmetic<Type>::value || std::is_enum<Type>::value,
+                          "records hold plain numeric fields");
+           #if JUCE_BIG_ENDIAN
+            auto* bytes = reinterpret_cast<char*>(&value);
+            std::reverse(bytes, bytes + sizeof(Type));
+           #endif
+            writeBytes(&value, static_cast<int>(sizeof(Type)));
+        }
+
+        template <typename Type>
+        void writeArray(const Type* values, int numValues) noexcept
+        {
+           #if JUCE_BIG_ENDIAN
+            for (int i = 0; i < numValues; ++i)
+                write(values[i]);
+           #else
+            writeBytes(values, static_cast<int>(sizeof(Type)) * numValues);
+           #endif
+        }
+
+    private:
+        friend class SessionCapture;
+        Record(SessionCapture& owner, int size) noexcept;
+
+        void writeBytes(const void* data, int numBytes) noexcept;
+
+        SessionCapture& owner_;
+        int size_ = 0;
+        int written_ = 0;
+        int start1_ = 0, size1_ = 0, start2_ = 0, size2_ = 0;
+
+        JUCE_DECLARE_NON_COPYABLE(Record)
+    };
+
+    // Audio thread (single producer). Returns an invalid record if capture is
+    // off or the ring has no room.
+    Record beginRecord(int numBytes) noexcept;
+
+private:
+    void run() override;
+    void drain();
+
+    static constexpr int kBufferBytes = 8 * 1024 * 1024;
+
+    juce::HeapBlock<char> buffer_;
+    std::unique_ptr<juce::AbstractFifo> fifo_;
+    std::unique_ptr<juce::FileOutputStream> stream_;
+    juce::File file_;
+
+    std::atomic<bool> active_{ false };
+    std::atomic<int> recordsInFlight_{ 0 };
+    std::atomic<int> dropped_{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SessionCapture)
+};
@@ -0,0 +1,210 @@
+#include "SpectrumAnalyzer.h"
+#include <cmath>
+
+SpectrumAnalyzer::SpectrumAnalyzer()
+    : juce::Thread("DRIFT Spectrum Analyzer")
+{
+    dryDb_.fill(kFloorDb);
+    wetDb_.fill(kFloorDb);
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    enabled_.store(false);
+    stopThread(1000);
+}
+
+void SpectrumAnalyzer::setEnabled(bool shouldBeEnabled)
+{
+    // Before enabling, so push never sees the rings unallocated
+    if (shouldBeEnabled && fft_ == nullptr)
+        allocate();
+
+    if (enabled_.exchange(shouldBeEnabled) == shouldBeEnabled)
+        return;
+
+    if (! shouldBeEnabled)
+        return;
+
+    // Whatever sat in the ring predates the pause
+    resetPending_.store(true);
+
+    if (! isThreadRunning())
+        startThread(juce::Thread::Priority::low);
+    else
+        notify();
+}
+
+void SpectrumAnalyzer::allocate()
+{
+    dryRing_.allocate(kRingSize, true);
+    wetRing_.allocate(kRingSize, true);
+
+    dryHistory_.assign(kFftSize, 0.0f);
+    wetHistory_.assign(kFftSize, 0.0f);
+    fftBuffer_.assign(kFftSize * 2, 0.0f);
+
+    fft_ = std::make_unique<juce::dsp::FFT>(kFftOrder);
+    window_ = std::make_unique<juce::dsp::WindowingFunction<float>>(static_cast<size_t>(kFftSize),
+                                                                    juce::dsp::WindowingFunction<float>::hann, false);
+}
+
+bool SpectrumAnalyzer::getLatestSpectrum(Spectrum& out)
+{
+    const juce::SpinLock::ScopedLockType lock(publishLock_);
+
+    if (! hasNewSpectrum_)
+        return false;
+
+    out = published_;
+    hasNewSpectrum_ = false;
+    return true;
+}
+
+void SpectrumAnalyzer::push(const float* dryL, const float* dryR, const float* wetL, const float* wetR, int numSamples) noexcept
+{
+    if (! enabled_.load(std::memory_order_acquire))
+        return;
+
+    const auto scope = fifo_.write(numSamples);
+
+    int source = 0;
+    for (int i = 0; i < scope.blockSize1; ++i, ++source)
+    {
+        dryRing_[scope.startIndex1 + i] = 0.5f * (dryL[source] + dryR[source]);
+        wetRing_[scope.startIndex1 + i] = 0.5f * (wetL[source] + wetR[source]);
+    }
+    for (int i = 0; i < scope.blockSize2; ++i, ++source)
+    {
+        dryRing_[scope.startIndex2 + i] = 0.5f * (dryL[source] + dryR[source]);
+        wetRing_[scope.startIndex2 + i] = 0.5f * (wetL[source] + wetR[source]);
+    }
+
+    if (source < numSamples)
+        dropped_.fetch_add(numSamples - source, std::memory_order_relaxed);
+}
+
+void SpectrumAnalyzer::run()
+{
+    while (! threadShouldExit())
+    {
+        if (! enabled_.load(std::memory_order_relaxed))
+        {
+            wait(-1);
+            continue;
+        }
+
+        if (resetPending_.exchange(false))
+            reset();
+
+        const double sampleRate = sampleRate_.load();
+        if (sampleRate != bandSampleRate_)
+            updateBands(sampleRate);
+
+        bool analysed = false;
+        while (fifo_.getNumReady() >= kHopSize && ! threadShouldExit())
+        {
+            readHop();
+            analyse(dryHistory_, dryDb_);
+            analyse(wetHistory_, wetDb_);
+            analysed = true;
+        }
+
+        if (analysed)
+            publish();
+
+        wait(kPollMs);
+    }
+}
+
+void SpectrumAnalyzer::reset()
+{
+    fifo_.finishedRead(fifo_.getNumReady());
+
+    std::fill(dryHistory_.begin(), dryHistory_.end(), 0.0f);
+    std::fill(wetHistory_.begin(), wetHistory_.end(), 0.0f);
+    dryDb_.fill(kFloorDb);
+    wetDb_.fill(kFloorDb);
+}
+
+void SpectrumAnalyzer::updateBands(double sampleRate)
+{
+    bandSampleRate_ = sampleRate;
+
+    // Log-spaced band edges in FFT bins. Low bands narrower than one bin still read
+    // the bin they fall in.
+    const int nyquistBin = kFftSize / 2;
+    const double binsPerHz = kFftSize / sampleRate;
+    const double ratio = static_cast<double>(kMaxFrequency) / kMinFrequency;
+
+    for (int band = 0; band <= kNumBands; ++band)
+    {
+        const double frequency = kMinFrequency * std::pow(ratio, static_cast<double>(band) / kNumBands);
+        bandEdges_[static_cast<size_t>(band)] = juce::jlimit(1, nyquistBin, static_cast<int>(frequency * binsPerHz));
+    }
+
+    // Ballistics per hop: fast rise, slower fall so repeats read as decaying shapes
+    const double hopSeconds = kHopSize / sampleRate;
+    attack_ = static_cast<float>(1.0 - std::exp(-hopSeconds / 0.02));
+    release_ = static_cast<float>(1.0 - std::exp(-hopSeconds / 0.3));
+}
+
+void SpectrumAnalyzer::readHop()
+{
+    // Slide both histories left by one hop and append the next hop from the ring
+    std::copy(dryHistory_.begin() + kHopSize, dryHistory_.end(), dryHistory_.begin());
+    std::copy(wetHistory_.begin() + kHopSize, wetHistory_.end(), wetHistory_.begin());
+
+    const auto scope = fifo_.read(kHopSize);
+    auto* dryDest = dryHistory_.data() + (kFftSize - kHopSize);
+    auto* wetDest = wetHistory_.data() + (kFftSize - kHopSize);
+
+    std::copy(dryRing_ + scope.startIndex1, dryRing_ + scope.startIndex1 + scope.blockSize1, dryDest);
+    std::copy(wetRing_ + scope.startIndex1, wetRing_ + scope.startIndex1 + scope.blockSize1, wetDest);
+    std::copy(dryRing_ + scope.startIndex2, dryRing_ + scope.startIndex2 + scope.blockSize2, dryDest + scope.blockSize1);
+    std::copy(wetRing_ + scope.startIndex2, wetRing_ + scope.startIndex2 + scope.blockSize2, wetDest + scope.blockSize1);
+}
+
+void SpectrumAnalyzer::analyse(const std::vector<float>& history, std::array<float, kNumBands>& levelsDb)
+{
+    std::copy(history.begin(), history.end(), fftBuffer_.begin());
+    std::fill(fftBuffer_.begin() + kFftSize, fftBuffer_.end(), 0.0f);
+
+    window_->multiplyWithWindowingTable(fftBuffer_.data(), static_cast<size_t>(kFftSize));
+    fft_->performFrequencyOnlyForwardTransform(fftBuffer_.data(), true);
+
+    // A full-scale sine reads 0 dB: magnitudes scale by the Hann window's coherent gain
+    constexpr float magnitudeScale = 4.0f / kFftSize;
+
+    for (int band = 0; band < kNumBands; ++band)
+    {
+        const int first = bandEdges_[static_cast<size_t>(band)];
+        const int last = juce::jmax(first + 1, bandEdges_[static_cast<size_t>(band) + 1]);
+
+        float peak = 0.0f;
+        for (int bin = first; bin < last && bin <= kFftSize / 2; ++bin)
+            peak = juce::jmax(peak, fftBuffer_[static_cast<size_t>(bin)]);
+
+        const float db = juce::Decibels::gainToDecibels(peak * magnitudeScale, kFloorDb);
+        auto& level = levelsDb[static_cast<size_t>(band)];
+        level += (db > level ? attack_ : release_) * (db - level);
+    }
+}
+
+void SpectrumAnalyzer::publish()
+{
+    const auto quantise = [](float db) {
+        return static_cast<juce::uint8>(juce::jlimit(0, 255, juce::roundToInt((db - kFloorDb) / -kFloorDb * 255.0f)));
+    };
+
+    Spectrum spectrum;
+    for (size_t band = 0; band < static_cast<size_t>(kNumBands); ++band)
+    {
+        spectrum.dry[band] = quantise(dryDb_[band]);
+        spectrum.wet[band] = quantise(wetDb_[band]);
+    }
+
+    const juce::SpinLock::ScopedLockType lock(publishLock_);
+    published_ = spectrum;
+    hasNewSpectrum_ = true;
+}
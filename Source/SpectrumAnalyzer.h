@@ -0,0 +1,100 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Dry vs wet spectrum analysis for the editor, kept off the audio thread.
+//
+// The audio thread only downmixes each chunk's dry input and wet signal to mono and
+// copies them into a preallocated lock-free ring (push). A low-priority worker takes
+// Hann-windowed FFTs from the ring with 75% overlap, folds them into log-spaced
+// bands, smooths each band and publishes the result for the editor to forward to
+// the WebView.
+//
+// Analysis only runs while an editor is showing (setEnabled). Otherwise push returns
+// after a single atomic load and the worker sleeps. The rings, FFT and window are
+// only allocated the first time analysis is enabled, so instances whose editor
+// never opens don't carry them. When the ring is full, samples
+// are dropped rather than waited for, so push never costs more than one copy of its
+// chunk. Its time is reported as the "analysis" stage in StageProfiler.
+class SpectrumAnalyzer : private juce::Thread
+{
+public:
+    static constexpr int kNumBands = 64;
+    static constexpr float kMinFrequency = 20.0f;
+    static constexpr float kMaxFrequency = 20000.0f;
+    static constexpr float kFloorDb = -90.0f;
+
+    // Band levels quantised to 0-255 over kFloorDb..0 dBFS, lowest band first
+    struct Spectrum
+    {
+        std::array<juce::uint8, kNumBands> dry{};
+        std::array<juce::uint8, kNumBands> wet{};
+    };
+
+    SpectrumAnalyzer();
+    ~SpectrumAnalyzer() override;
+
+    // Any thread
+    void prepare(double sampleRate) noexcept { sampleRate_.store(sampleRate > 0.0 ? sampleRate : 44100.0); }
+    bool isEnabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+    int getNumDroppedSamples() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+    // Message thread. Allocates the analysis buffers and starts the worker the first
+    // time analysis is enabled.
+    void setEnabled(bool shouldBeEnabled);
+
+    // Copies the latest spectrum into out. Returns false if nothing new has been
+    // published since the last call.
+    bool getLatestSpectrum(Spectrum& out);
+
+    // Audio thread (single producer)
+    void push(const float* dryL, const float* dryR, const float* wetL, const float* wetR, int numSamples) noexcept;
+
+private:
+    void run() override;
+    void allocate();
+    void reset();
+    void updateBands(double sampleRate);
+    void readHop();
+    void analyse(const std::vector<float>& history, std::array<float, kNumBands>& levelsDb);
+    void publish();
+
+    static constexpr int kFftOrder = 11;
+    static constexpr int kFftSize = 1 << kFftOrder;
+    static constexpr int kHopSize = kFftSize / 4;
+    static constexpr int kRingSize = kFftSize * 16;
+    static constexpr int kPollMs = 15;
+
+    // Audio thread -> worker
+    juce::HeapBlock<float> dryRing_;
+    juce::HeapBlock<float> wetRing_;
+    juce::AbstractFifo fifo_{ kRingSize };
+    std::atomic<bool> enabled_{ false };
+    std::atomic<bool> resetPending_{ false };
+    std::atomic<int> dropped_{ 0 };
+    std::atomic<double> sampleRate_{ 44100.0 };
+
+    // Worker state
+    std::unique_ptr<juce::dsp::FFT> fft_;
+    std::unique_ptr<juce::dsp::WindowingFunction<float>> window_;
+    std::vector<float> dryHistory_;
+    std::vector<float> wetHistory_;
+    std::vector<float> fftBuffer_;
+    std::array<int, kNumBands + 1> bandEdges_{};
+    std::array<float, kNumBands> dryDb_{};
+    std::array<float, kNumBands> wetDb_{};
+    double bandSampleRate_ = 0.0;
+    float attack_ = 1.0f;
+    float release_ = 1.0f;
+
+    // Worker -> message thread
+    juce::SpinLock publishLock_;
+    Spectrum published_;
+    bool hasNewSpectrum_ = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumAnalyzer)
+};
@@ -0,0 +1,54 @@
+#include "StageProfiler.h"
+
+const char* StageProfiler::getStageName(int stage)
+{
+    static const char* const names[numStages] = {
+        "control", "tapRead", "diffusion", "tapSum", "wetFilter", "feedback", "mix", "analysis"
+    };
+    return names[juce::jlimit(0, numStages - 1, stage)];
+}
+
+void StageProfiler::prepare(double sampleRate)
+{
+    sampleRate_ = sampleRate > 0.0 ? sampleRate : 44100.0;
+    ticksPerSecond_ = static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+
+    ticks_.fill(0);
+    load_.fill(0.0f);
+    totalTicks_.fill(0);
+    for (auto& load : reportedLoad_)
+        load.store(0.0f, std::memory_order_relaxed);
+}
+
+void StageProfiler::endBlock(int numSamples) noexcept
+{
+#if DRIFT_STAGE_PROFILING
+    if (numSamples <= 0)
+        return;
+
+    const double budgetSeconds = numSamples / sampleRate_;
+
+    for (int stage = 0; stage < numStages; ++stage)
+    {
+        const double seconds = static_cast<double>(ticks_[stage]) / ticksPerSecond_;
+        const float blockLoad = static_cast<float>(seconds / budgetSeconds);
+
+        load_[stage] += 0.05f * (blockLoad - load_[stage]);
+        reportedLoad_[stage].store(load_[stage], std::memory_order_relaxed);
+        totalTicks_[stage] += ticks_[stage];
+        ticks_[stage] = 0;
+    }
+#else
+    juce::ignoreUnused(numSamples);
+#endif
+}
+
+float StageProfiler::getStageLoad(int stage) const noexcept
+{
+    return reportedLoad_[static_cast<size_t>(juce::jlimit(0, numStages - 1, stage))].load(std::memory_order_relaxed);
+}
+
+double StageProfiler::getTotalSeconds(int stage) const noexcept
+{
+    return static_cast<double>(totalTicks_[static_cast<size_t>(juce::jlimit(0, numStages - 1, stage))]) / ticksPerSecond_;
+}
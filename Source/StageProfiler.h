@@ -0,0 +1,73 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+
+// Per-stage timing for the DSP pipeline in DriftProcessor::renderRange.
+//
+// Each stage's time is accumulated over a block and reported as its share of the
+// block's real-time budget, smoothed for display. Timing is compiled in only when
+// DRIFT_STAGE_PROFILING is enabled; otherwise Scope is empty and the loads stay 0.
+class StageProfiler
+{
+public:
+    enum Stage
+    {
+        control,    // Ducking envelope, parameter smoothing, drift LFOs
+        tapRead,    // Tap read positions, interpolated reads, age and grit
+        diffusion,  // Per-tap allpass diffusers
+        tapSum,     // Panned tap sum and tap meters
+        wetFilter,  // Global highpass/lowpass and ducking
+        feedback,   // Feedback reads, saturation and delay-line writes
+        mix,        // Dry/wet mix
+        analysis,   // Dry/wet copy into the spectrum analyzer's ring
+        numStages
+    };
+
+    static const char* getStageName(int stage);
+
+    void prepare(double sampleRate);
+
+#if DRIFT_STAGE_PROFILING
+    class Scope
+    {
+    public:
+        Scope(StageProfiler& owner, Stage stage) noexcept
+            : owner_(owner), stage_(stage), start_(juce::Time::getHighResolutionTicks()) {}
+
+        ~Scope() noexcept { owner_.ticks_[stage_] += juce::Time::getHighResolutionTicks() - start_; }
+
+    private:
+        StageProfiler& owner_;
+        Stage stage_;
+        juce::int64 start_;
+    };
+#else
+    struct Scope
+    {
+        Scope(StageProfiler&, Stage) noexcept {}
+    };
+#endif
+
+    // Audio thread, once per processBlock
+    void endBlock(int numSamples) noexcept;
+
+    // Any thread
+    float getStageLoad(int stage) const noexcept;
+
+    // Time spent in a stage since prepare(). Read only while processing is stopped
+    // (offline tools such as DriftReplay).
+    double getTotalSeconds(int stage) const noexcept;
+
+private:
+    double sampleRate_ = 44100.0;
+    double ticksPerSecond_ = 1.0;
+
+    // Audio thread state
+    std::array<juce::int64, numStages> ticks_{};
+    std::array<float, numStages> load_{};
+    std::array<juce::int64, numStages> totalTicks_{};
+
+    std::array<std::atomic<float>, numStages> reportedLoad_{};
+};
@@ -0,0 +1,225 @@
+// Local stand-in for the BeatConnect activation server, for testing activation
+// without the network or a real licence.
+//
+//   DRIFTMockActivationServer [--port N] [--key FILE] [--delay MS] [--reject] [--requests N]
+//
+// POST /activation/token answers with a validity token signed by the key in FILE
+// (created on first run), exactly as ActivationService expects. Anything else,
+// such as the SDK's own activation calls, is logged and answered with a generic
+// valid status. --reject refuses tokens and reports every device as not
+// activated; --delay holds each response back, to try slow networks and closing
+// instances while validation is still running; --requests exits after N requests.
+//
+// Point a dev build (DRIFT_DEV_MODE) at it with the two environment variables it
+// prints. Release builds ignore both.
+
+#include "../Source/ActivationToken.h"
+#include <cstdio>
+
+namespace
+{
+    struct Request
+    {
+        juce::String method;
+        juce::String path;
+        juce::String body;
+    };
+
+    bool readRequest(juce::StreamingSocket& socket, Request& request)
+    {
+        constexpr size_t kMaxRequestBytes = 65536;
+
+        juce::MemoryBlock data;
+        char buffer[4096];
+        int headerEnd = -1;
+        int contentLength = 0;
+
+        for (;;)
+        {
+            if (headerEnd >= 0 && data.getSize() >= static_cast<size_t>(headerEnd + 4 + contentLength))
+                break;
+
+            if (data.getSize() > kMaxRequestBytes || socket.waitUntilReady(true, 5000) != 1)
+                return false;
+
+            const int numRead = socket.read(buffer, static_cast<int>(sizeof(buffer)), false);
+            if (numRead <= 0)
+                return false;
+
+            data.append(buffer, static_cast<size_t>(numRead));
+
+            if (headerEnd < 0)
+            {
+                // Headers are ASCII, so character and byte offsets agree
+                headerEnd = data.toString().indexOf("\r\n\r\n");
+
+                if (headerEnd >= 0)
+                {
+                    const auto lines = juce::StringArray::fromLines(data.toString().substring(0, headerEnd));
+                    const auto requestLine = juce::StringArray::fromTokens(lines[0], " ", "");
+                    request.method = requestLine[0];
+                    request.path = requestLine[1].upToFirstOccurrenceOf("?", false, false);
+
+                    for (const auto& line : lines)
+                        if (line.startsWithIgnoreCase("content-length:"))
+                            contentLength = line.fromFirstOccurrenceOf(":", false, false).trim().getIntValue();
+                }
+            }
+        }
+
+        request.body = juce::String::fromUTF8(static_cast<const char*>(data.getData()) + headerEnd + 4, contentLength);
+        return true;
+    }
+
+    void sendResponse(juce::StreamingSocket& socket, int status, const juce::String& body)
+    {
+        const char* reason = status == 200 ? "OK"
+                           : status == 400 ? "Bad Request"
+                           : status == 403 ? "Forbidden"
+                                           : "Error";
+
+        const auto response = "HTTP/1.1 " + juce::String(status) + " " + reason + "\r\n"
+                            + "Content-Type: application/json\r\n"
+                            + "Content-Length: " + juce::String(static_cast<int>(body.getNumBytesAsUTF8())) + "\r\n"
+                            + "Connection: close\r\n\r\n"
+                            + body;
+
+        socket.write(response.toRawUTF8(), static_cast<int>(response.getNumBytesAsUTF8()));
+    }
+
+    bool loadOrCreateKeys(const juce::File& file, juce::RSAKey& publicKey, juce::RSAKey& privateKey)
+    {
+        if (file.existsAsFile())
+        {
+            juce::StringArray lines;
+            file.readLines(lines);
+            publicKey = juce::RSAKey(lines[0].trim());
+            privateKey = juce::RSAKey(lines[1].trim());
+            return publicKey.isValid() && privateKey.isValid();
+        }
+
+        std::printf("Creating a 2048-bit signing key in %s...\n", file.getFullPathName().toRawUTF8());
+        juce::RSAKey::createKeyPair(publicKey, privateKey, 2048);
+        return file.replaceWithText(publicKey.toString() + "\n" + privateKey.toString() + "\n");
+    }
+
+    juce::var makeObject(std::initializer_list<std::pair<const char*, juce::var>> properties)
+    {
+        juce::DynamicObject::Ptr object = new juce::DynamicObject();
+        for (const auto& [name, value] : properties)
+            object->setProperty(name, value);
+        return juce::var(object.get());
+    }
+
+    int handleTokenRequest(const Request& request, const juce::RSAKey& privateKey, bool reject, juce::String& body)
+    {
+        const auto json = juce::JSON::parse(request.body);
+        const auto pluginId = json.getProperty("pluginId", "").toString();
+        const auto deviceId = json.getProperty("deviceId", "").toString();
+
+        if (pluginId.isEmpty() || deviceId.isEmpty())
+        {
+            body = juce::JSON::toString(makeObject({ { "error", "pluginId and deviceId are required" } }));
+            return 400;
+        }
+
+        if (reject)
+        {
+            body = juce::JSON::toString(makeObject({ { "error", "not activated" } }));
+            return 403;
+        }
+
+        const auto validatedAt = juce::Time::currentTimeMillis();
+        const auto signature = ActivationToken::sign(ActivationToken::getSignedPayload(pluginId, deviceId, validatedAt), privateKey);
+
+        body = juce::JSON::toString(makeObject({ { "pluginId", pluginId },
+                                                 { "deviceId", deviceId },
+                                                 { "validatedAt", validatedAt },
+                                                 { "signature", signature } }));
+        return 200;
+    }
+
+    int usage()
+    {
+        std::fprintf(stderr, "usage: DRIFTMockActivationServer [--port N] [--key FILE] [--delay MS] [--reject] [--requests N]\n");
+        return 1;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(juce::CharPointer_UTF8(argv[i]));
+
+    int port = 8787;
+    int delayMs = 0;
+    int maxRequests = 0;
+    bool reject = false;
+    auto keyFile = juce::File::getCurrentWorkingDirectory().getChildFile("mock-activation.key");
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        if (args[i] == "--port" && i + 1 < args.size())
+            port = args[++i].getIntValue();
+        else if (args[i] == "--key" && i + 1 < args.size())
+            keyFile = juce::File::getCurrentWorkingDirectory().getChildFile(args[++i]);
+        else if (args[i] == "--delay" && i + 1 < args.size())
+            delayMs = juce::jmax(0, args[++i].getIntValue());
+        else if (args[i] == "--requests" && i + 1 < args.size())
+            maxRequests = juce::jmax(0, args[++i].getIntValue());
+        else if (args[i] == "--reject")
+            reject = true;
+        else
+            return usage();
+    }
+
+    juce::RSAKey publicKey, privateKey;
+    if (! loadOrCreateKeys(keyFile, publicKey, privateKey))
+    {
+        std::fprintf(stderr, "cannot read or create a key pair in %s\n", keyFile.getFullPathName().toRawUTF8());
+        return 1;
+    }
+
+    juce::StreamingSocket listener;
+    if (! listener.createListener(port, "127.0.0.1"))
+    {
+        std::fprintf(stderr, "cannot listen on port %d\n", port);
+        return 1;
+    }
+
+    std::printf("DRIFTMockActivationServer listening on http://127.0.0.1:%d%s\n", port, reject ? " (rejecting)" : "");
+    std::printf("  DRIFT_ACTIVATION_API_URL=http://127.0.0.1:%d\n", port);
+    std::printf("  DRIFT_ACTIVATION_PUBLIC_KEY=%s\n", publicKey.toString().toRawUTF8());
+    std::fflush(stdout);
+
+    for (int handled = 0; maxRequests == 0 || handled < maxRequests; ++handled)
+    {
+        std::unique_ptr<juce::StreamingSocket> client(listener.waitForNextConnection());
+        if (client == nullptr)
+            break;
+
+        Request request;
+        if (! readRequest(*client, request))
+            continue;
+
+        if (delayMs > 0)
+            juce::Thread::sleep(delayMs);
+
+        juce::String body;
+        int status = 200;
+
+        if (request.method == "POST" && request.path.endsWith("/activation/token"))
+            status = handleTokenRequest(request, privateKey, reject, body);
+        else
+            body = juce::JSON::toString(makeObject({ { "valid", ! reject },
+                                                     { "status", reject ? "invalid" : "valid" } }));
+
+        sendResponse(*client, status, body);
+
+        std::printf("%s %s -> %d\n", request.method.toRawUTF8(), request.path.toRawUTF8(), status);
+        std::fflush(stdout);
+    }
+
+    return 0;
+}
@@ -0,0 +1,289 @@
+// Drives DriftProcessor headless through a grid of parameter settings with the
+// real-time checks on (see Source/RealtimeSafety.h), so any allocation, lock or
+// blocking call a setting reaches inside processBlock aborts the run.
+//
+//   DRIFTRealtimeSweep [--blocks N]
+//
+// The grid covers sync on and off, every tap count, every division, Diffuse
+// below and above its 0.001 threshold, and Spread, Grit, Age and Duck both at zero
+// and engaged, at each quality tier and for a few sample rate / block size
+// configurations. Consecutive grid points ramp Diffuse across its threshold, so
+// the per-sample crossing path runs too. Blocks alternate between the prepared
+// size and shorter ones, as hosts deliver them, and carry sample-accurate
+// parameter events as a CLAP host sends them, every fourth block more than the
+// event queue holds. Session capture runs throughout, and after the grid, state
+// restores on another thread overlap processBlock so it reads the held snapshot.
+// Exits non-zero if the output is ever not finite.
+
+#include "../Source/PluginProcessor.h"
+#include "../Source/ParameterIDs.h"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+#if ! DRIFT_REALTIME_CHECKS
+ #error "DRIFTRealtimeSweep must be built with the real-time checks on"
+#endif
+
+namespace
+{
+    struct Configuration
+    {
+        double sampleRate;
+        int blockSize;
+    };
+
+    constexpr Configuration kConfigurations[] = {
+        { 44100.0, 512 },
+        { 48000.0, 64 },
+        { 96000.0, 1024 }
+    };
+
+    // Diffuse settings either side of the diffuser's threshold
+    constexpr float kDiffuseValues[] = { 0.0f, 60.0f };
+
+    struct Amounts
+    {
+        float spread, grit, age, duck;
+    };
+
+    // Everything off, so the zero-amount branches run, and everything engaged
+    constexpr Amounts kAmounts[] = {
+        { 0.0f, 0.0f, 0.0f, 0.0f },
+        { 100.0f, 40.0f, 50.0f, 30.0f }
+    };
+
+    // More than the processor's event queue holds, so its overflow path runs
+    constexpr int kOverflowEvents = 300;
+
+    // The snapshot phase runs at least this many blocks per grid point, and this
+    // many restores, with the restores looping on another thread
+    constexpr int kSnapshotBlocksPerPoint = 32;
+    constexpr int kMinSnapshotRestores = 1000;
+
+    class SweepPlayHead : public juce::AudioPlayHead
+    {
+    public:
+        juce::Optional<PositionInfo> getPosition() const override
+        {
+            PositionInfo info;
+            info.setBpm(128.0);
+            info.setIsPlaying(true);
+            return info;
+        }
+    };
+
+    void setParameter(DriftProcessor& processor, const char* id, float value)
+    {
+        auto* param = processor.getAPVTS().getParameter(id);
+        param->setValueNotifyingHost(param->convertTo0to1(value));
+    }
+
+    // Sample-accurate Time, Feedback and Mix changes spread through the block
+    void queueParamEvents(DriftProcessor& processor, int numSamples, int numEvents)
+    {
+        constexpr float kTimes[] = { 90.0f, 160.0f, 240.0f };
+        constexpr float kFeedbacks[] = { 70.0f, 85.0f };
+        constexpr float kMixes[] = { 40.0f, 60.0f };
+
+        for (int e = 0; e < numEvents; ++e)
+        {
+            const int offset = numSamples * e / numEvents;
+
+            switch (e % 3)
+            {
+                case 0:  processor.queueParamEvent(offset, ParameterIDs::timeIndex, kTimes[(e / 3) % 3]); break;
+                case 1:  processor.queueParamEvent(offset, ParameterIDs::feedbackIndex, kFeedbacks[(e / 3) % 2]); break;
+                default: processor.queueParamEvent(offset, ParameterIDs::mixIndex, kMixes[(e / 3) % 2]); break;
+            }
+        }
+    }
+
+    void fillInput(juce::AudioBuffer<float>& buffer, int numSamples, juce::Random& random, double& phase, double sampleRate)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float tone = 0.4f * static_cast<float>(std::sin(phase));
+            phase += juce::MathConstants<double>::twoPi * 220.0 / sampleRate;
+
+            buffer.setSample(0, i, tone + 0.1f * (random.nextFloat() * 2.0f - 1.0f));
+            buffer.setSample(1, i, tone + 0.1f * (random.nextFloat() * 2.0f - 1.0f));
+        }
+    }
+
+    bool isFinite(const juce::AudioBuffer<float>& buffer, int numSamples)
+    {
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            for (int i = 0; i < numSamples; ++i)
+                if (! std::isfinite(buffer.getSample(channel, i)))
+                    return false;
+        return true;
+    }
+
+    int usage()
+    {
+        std::fprintf(stderr, "usage: DRIFTRealtimeSweep [--blocks N]\n");
+        return 1;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(juce::CharPointer_UTF8(argv[i]));
+
+    int blocksPerPoint = 8;
+    for (int i = 0; i < args.size(); ++i)
+    {
+        if (args[i] == "--blocks" && i + 1 < args.size())
+            blocksPerPoint = juce::jmax(1, args[++i].getIntValue());
+        else
+            return usage();
+    }
+
+    std::printf("DRIFTRealtimeSweep: checks via %s, kernels %s\n",
+                DRIFT_RTSAN ? "RealtimeSanitizer" : "interposed calls", DriftKernels::get().name);
+
+    juce::int64 totalBlocks = 0;
+
+    for (const auto& config : kConfigurations)
+    {
+        DriftProcessor processor;
+        processor.getSpectrumAnalyzer().setEnabled(true); // As with an editor open
+
+        SweepPlayHead playHead;
+        processor.setPlayHead(&playHead);
+        processor.setRateAndBufferSizeDetails(config.sampleRate, config.blockSize);
+        processor.prepareToPlay(config.sampleRate, config.blockSize);
+
+        // Capture on throughout, so every block also writes its record. This replaces
+        // any capture DRIFT_CAPTURE_DIR started.
+        const auto captureFile = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                                     .getNonexistentChildFile("DRIFTRealtimeSweep", ".driftcap");
+        if (! processor.startSessionCapture(captureFile))
+        {
+            std::fprintf(stderr, "cannot start session capture in %s\n", captureFile.getFullPathName().toRawUTF8());
+            return 1;
+        }
+
+        const auto& divisions = processor.getAPVTS().getParameter(ParameterIDs::division)->getNormalisableRange();
+        const int numDivisions = juce::roundToInt(divisions.end - divisions.start) + 1;
+
+        juce::AudioBuffer<float> buffer(2, config.blockSize);
+        juce::MidiBuffer midi;
+        juce::Random random(0x5eed);
+        double phase = 0.0;
+        int points = 0;
+
+        // Returns false if the output went non-finite
+        auto runBlock = [&](int b)
+        {
+            // Every other block is shorter than the prepared size
+            const int numSamples = (b % 2 == 0) ? config.blockSize
+                                                : juce::jmax(1, config.blockSize / (2 + b % 3) - 1);
+            buffer.setSize(2, numSamples, false, false, true);
+            fillInput(buffer, numSamples, random, phase, config.sampleRate);
+
+            queueParamEvents(processor, numSamples, b % 4 == 3 ? kOverflowEvents : 3);
+            processor.processBlock(buffer, midi);
+
+            ++totalBlocks;
+            return isFinite(buffer, numSamples);
+        };
+
+        // Repeats long enough for feedback and grit to build up
+        setParameter(processor, ParameterIDs::time, 120.0f);
+        setParameter(processor, ParameterIDs::feedback, 85.0f);
+        setParameter(processor, ParameterIDs::mix, 60.0f);
+
+        for (int tier = 0; tier < QualityGovernor::kNumTiers; ++tier)
+        {
+            processor.getQualityGovernor().setForcedTier(tier);
+
+            for (int sync = 0; sync < 2; ++sync)
+            {
+                for (int taps = 1; taps <= 4; ++taps)
+                {
+                    for (int division = 0; division < numDivisions; ++division)
+                    {
+                        for (const auto& amounts : kAmounts)
+                        {
+                            for (const float diffuse : kDiffuseValues)
+                            {
+                                setParameter(processor, ParameterIDs::sync, static_cast<float>(sync));
+                                setParameter(processor, ParameterIDs::taps, static_cast<float>(taps));
+                                setParameter(processor, ParameterIDs::division, static_cast<float>(division));
+                                setParameter(processor, ParameterIDs::diffuse, diffuse);
+                                setParameter(processor, ParameterIDs::spread, amounts.spread);
+                                setParameter(processor, ParameterIDs::grit, amounts.grit);
+                                setParameter(processor, ParameterIDs::age, amounts.age);
+                                setParameter(processor, ParameterIDs::duck, amounts.duck);
+
+                                for (int b = 0; b < blocksPerPoint; ++b)
+                                {
+                                    if (! runBlock(b))
+                                    {
+                                        std::fprintf(stderr, "non-finite output at %.0f Hz: tier %d, sync %d, taps %d, division %d, "
+                                                             "diffuse %.0f, grit %.0f\n",
+                                                     config.sampleRate, tier, sync, taps, division, diffuse, amounts.grit);
+                                        return 1;
+                                    }
+                                }
+                                ++points;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Restores alternating between two snapshots on another thread, as the
+        // message thread runs them, while blocks keep coming
+        processor.getQualityGovernor().setForcedTier(0);
+
+        auto varied = processor.getDefaultSnapshot();
+        varied.values[ParameterIDs::syncIndex] = 1.0f;
+        varied.values[ParameterIDs::tapsIndex] = 4.0f;
+        varied.values[ParameterIDs::divisionIndex] = static_cast<float>(numDivisions - 1);
+        varied.values[ParameterIDs::diffuseIndex] = 60.0f;
+        varied.values[ParameterIDs::spreadIndex] = 100.0f;
+        const auto defaults = processor.getDefaultSnapshot();
+
+        std::atomic<bool> restoring{ true };
+        std::atomic<int> restores{ 0 };
+        std::thread restorer([&]
+        {
+            for (int i = 0; restoring.load(); ++i, ++restores)
+                processor.applySnapshot(i % 2 == 0 ? varied : defaults);
+        });
+
+        bool finite = true;
+        for (int b = 0; finite && (b < blocksPerPoint * kSnapshotBlocksPerPoint || restores.load() < kMinSnapshotRestores); ++b)
+            finite = runBlock(b);
+
+        restoring.store(false);
+        restorer.join();
+
+        if (! finite)
+        {
+            std::fprintf(stderr, "non-finite output at %.0f Hz while restoring snapshots\n", config.sampleRate);
+            return 1;
+        }
+
+        processor.getSpectrumAnalyzer().setEnabled(false);
+        processor.stopSessionCapture();
+        processor.releaseResources();
+        captureFile.deleteFile();
+
+        std::printf("  %.0f Hz / %d samples: %d grid points and %d snapshot restores clean, %d capture records dropped\n",
+                    config.sampleRate, config.blockSize, points, restores.load(),
+                    processor.getSessionCapture().getNumDroppedRecords());
+    }
+
+    std::printf("%lld blocks processed without a real-time violation\n", static_cast<long long>(totalBlocks));
+    return 0;
+}
@@ -0,0 +1,407 @@
+// Replays a session capture (see Source/SessionCapture.h) through
+// DriftProcessor::processBlock, block by block exactly as the host delivered it,
+// and reports per-block and per-stage timing.
+//
+//   DRIFTReplay <capture.driftcap> [--repeat N] [--isa generic|sse2|avx2|avx512|neon]
+//                                  [--output out.wav] [--spectrum]
+//
+// --spectrum runs the spectrum analyzer as if an editor were open, so its
+// audio-thread cost is part of the block load; DRIFT_STAGE_PROFILING builds also
+// show it as the "analysis" stage. DRIFTStartupBench --analyzer measures it
+// without a capture or a profiling build.
+//
+// Each pass uses a fresh processor with the captured quality tiers pinned, so
+// repeated passes (and machines with the same kernel ISA) render identical output.
+// The output checksum printed per pass makes that easy to confirm.
+
+#include "../Source/PluginProcessor.h"
+#include "../Source/ParameterIDs.h"
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    struct ParamChange
+    {
+        int sampleOffset;
+        int index;
+        float value;
+    };
+
+    struct CapturedBlock
+    {
+        int sequence = 0;
+        double bpm = 120.0;
+        int qualityTier = 0;
+        std::vector<float> parameters;
+        std::vector<ParamChange> events;
+        juce::AudioBuffer<float> input;
+
+        // prepareToPlay seen just before this block (sampleRate 0 if none)
+        double prepareSampleRate = 0.0;
+        int prepareBlockSize = 0;
+    };
+
+    struct Capture
+    {
+        juce::StringArray parameterIds;
+        std::vector<CapturedBlock> blocks;
+        int droppedBlocks = 0;
+    };
+
+    class ReplayPlayHead : public juce::AudioPlayHead
+    {
+    public:
+        double bpm = 120.0;
+
+        juce::Optional<PositionInfo> getPosition() const override
+        {
+            PositionInfo info;
+            info.setBpm(bpm);
+            info.setIsPlaying(true);
+            return info;
+        }
+    };
+
+    bool loadCapture(const juce::File& file, Capture& capture, juce::String& error)
+    {
+        juce::MemoryBlock data;
+        if (! file.loadFileAsData(data))
+        {
+            error = "cannot read " + file.getFullPathName();
+            return false;
+        }
+
+        juce::MemoryInputStream in(data, false);
+
+        char magic[4] = {};
+        if (in.read(magic, 4) != 4 || std::memcmp(magic, "DCAP", 4) != 0)
+        {
+            error = "not a DRIFT session capture";
+            return false;
+        }
+
+        const int version = in.readInt();
+        if (version != SessionCapture::kFormatVersion)
+        {
+            error = "unsupported capture version " + juce::String(version);
+            return false;
+        }
+
+        const int numParameters = in.readInt();
+        for (int i = 0; i < numParameters; ++i)
+            capture.parameterIds.add(in.readString());
+
+        double pendingSampleRate = 0.0;
+        int pendingBlockSize = 0;
+        int expectedSequence = -1;
+
+        while (! in.isExhausted())
+        {
+            const auto type = static_cast<juce::uint8>(in.readByte());
+
+            if (type == SessionCapture::prepareRecord)
+            {
+                pendingSampleRate = in.readDouble();
+                pendingBlockSize = in.readInt();
+                continue;
+            }
+
+            if (type != SessionCapture::blockRecord)
+            {
+                error = "corrupt record at byte " + juce::String(in.getPosition() - 1);
+                return false;
+            }
+
+            CapturedBlock block;
+            block.sequence = in.readInt();
+            const int numSamples = in.readInt();
+            const int numChannels = in.readInt();
+            block.bpm = in.readDouble();
+            block.qualityTier = in.readInt();
+
+            for (int i = 0; i < numParameters; ++i)
+                block.parameters.push_back(in.readFloat());
+
+            const int numEvents = in.readInt();
+            for (int e = 0; e < numEvents; ++e)
+            {
+                ParamChange change;
+                change.sampleOffset = in.readInt();
+                change.index = in.readInt();
+                change.value = in.readFloat();
+                block.events.push_back(change);
+            }
+
+            if (numSamples < 0 || numChannels <= 0 || in.getNumBytesRemaining() < static_cast<juce::int64>(numSamples) * numChannels * 4)
+            {
+                error = "truncated capture (block " + juce::String(block.sequence) + ")";
+                return false;
+            }
+
+            block.input.setSize(numChannels, numSamples);
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+               #if JUCE_BIG_ENDIAN
+                auto* samples = block.input.getWritePointer(channel);
+                for (int i = 0; i < numSamples; ++i)
+                    samples[i] = in.readFloat();
+               #else
+                in.read(block.input.getWritePointer(channel), numSamples * 4);
+               #endif
+            }
+
+            block.prepareSampleRate = pendingSampleRate;
+            block.prepareBlockSize = pendingBlockSize;
+            pendingSampleRate = 0.0;
+
+            if (expectedSequence >= 0 && block.sequence != expectedSequence)
+                capture.droppedBlocks += block.sequence - expectedSequence;
+            expectedSequence = block.sequence + 1;
+
+            capture.blocks.push_back(std::move(block));
+        }
+
+        if (capture.blocks.empty() || capture.blocks.front().prepareSampleRate <= 0.0)
+        {
+            error = "capture has no prepareToPlay record before its first block";
+            return false;
+        }
+        return true;
+    }
+
+    bool selectIsa(const juce::String& name)
+    {
+        for (auto isa : { DriftKernels::Isa::Generic, DriftKernels::Isa::SSE2, DriftKernels::Isa::AVX2,
+                          DriftKernels::Isa::AVX512, DriftKernels::Isa::NEON })
+        {
+            if (name.equalsIgnoreCase(DriftKernels::getIsaName(isa)))
+                return DriftKernels::select(isa);
+        }
+        return false;
+    }
+
+    struct BlockTiming
+    {
+        size_t block;
+        double load; // Processing time / real-time budget
+    };
+
+    struct PassResult
+    {
+        std::vector<BlockTiming> timings;
+        double seconds = 0.0;
+        double audioSeconds = 0.0;
+        juce::uint64 checksum = 14695981039346656037ull;
+        std::array<double, StageProfiler::numStages> stageSeconds{};
+    };
+
+    PassResult runPass(const Capture& capture, juce::AudioBuffer<float>* output, bool spectrum)
+    {
+        PassResult result;
+
+        DriftProcessor processor;
+        processor.stopSessionCapture(); // Never capture the replay itself
+        processor.getSpectrumAnalyzer().setEnabled(spectrum);
+
+        ReplayPlayHead playHead;
+        processor.setPlayHead(&playHead);
+
+        // Map capture parameters onto this build's parameter table by ID
+        std::vector<int> indexMap;
+        std::vector<juce::RangedAudioParameter*> parameters;
+        for (const auto& id : capture.parameterIds)
+        {
+            const auto it = std::find_if(ParameterIDs::all.begin(), ParameterIDs::all.end(),
+                                         [&](const char* known) { return id == known; });
+            indexMap.push_back(it != ParameterIDs::all.end() ? static_cast<int>(it - ParameterIDs::all.begin()) : -1);
+            parameters.push_back(processor.getAPVTS().getParameter(id));
+        }
+
+        juce::AudioBuffer<float> buffer;
+        double sampleRate = 44100.0;
+        const auto ticksPerSecond = static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+        juce::int64 outputPos = 0;
+
+        for (size_t b = 0; b < capture.blocks.size(); ++b)
+        {
+            const auto& block = capture.blocks[b];
+
+            if (block.prepareSampleRate > 0.0)
+            {
+                sampleRate = block.prepareSampleRate;
+                processor.setRateAndBufferSizeDetails(sampleRate, block.prepareBlockSize);
+                processor.prepareToPlay(sampleRate, block.prepareBlockSize);
+            }
+
+            for (size_t i = 0; i < block.parameters.size(); ++i)
+                if (auto* param = parameters[i])
+                    param->setValue(param->convertTo0to1(block.parameters[i]));
+
+            for (const auto& event : block.events)
+                if (event.index >= 0 && event.index < static_cast<int>(indexMap.size()) && indexMap[static_cast<size_t>(event.index)] >= 0)
+                    processor.queueParamEvent(event.sampleOffset, indexMap[static_cast<size_t>(event.index)], event.value);
+
+            processor.getQualityGovernor().setForcedTier(block.qualityTier);
+            playHead.bpm = block.bpm;
+
+            const int numSamples = block.input.getNumSamples();
+            buffer.makeCopyOf(block.input, true);
+
+            juce::MidiBuffer midi;
+            const auto start = juce::Time::getHighResolutionTicks();
+            processor.processBlock(buffer, midi);
+            const auto elapsed = static_cast<double>(juce::Time::getHighResolutionTicks() - start) / ticksPerSecond;
+
+            const double budget = numSamples / sampleRate;
+            result.timings.push_back({ b, budget > 0.0 ? elapsed / budget : 0.0 });
+            result.seconds += elapsed;
+            result.audioSeconds += budget;
+
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            {
+                const auto* bytes = reinterpret_cast<const juce::uint8*>(buffer.getReadPointer(channel));
+                for (size_t i = 0; i < static_cast<size_t>(numSamples) * sizeof(float); ++i)
+                    result.checksum = (result.checksum ^ bytes[i]) * 1099511628211ull;
+            }
+
+            if (output != nullptr)
+            {
+                if (outputPos + numSamples > output->getNumSamples())
+                    output->setSize(2, static_cast<int>(juce::jmax<juce::int64>(outputPos + numSamples, output->getNumSamples() * 2)), true);
+
+                for (int channel = 0; channel < juce::jmin(2, buffer.getNumChannels()); ++channel)
+                    output->copyFrom(channel, static_cast<int>(outputPos), buffer, channel, 0, numSamples);
+            }
+            outputPos += numSamples;
+        }
+
+        if (output != nullptr)
+            output->setSize(2, static_cast<int>(outputPos), true);
+
+        for (int stage = 0; stage < StageProfiler::numStages; ++stage)
+            result.stageSeconds[static_cast<size_t>(stage)] = processor.getStageProfiler().getTotalSeconds(stage);
+
+        return result;
+    }
+
+    void printPass(int pass, const Capture& capture, PassResult result)
+    {
+        std::printf("\nPass %d: %.3f s for %.3f s of audio (%.1fx real time), checksum %016llx\n",
+                    pass, result.seconds, result.audioSeconds,
+                    result.seconds > 0.0 ? result.audioSeconds / result.seconds : 0.0,
+                    static_cast<unsigned long long>(result.checksum));
+
+        auto& timings = result.timings;
+        std::sort(timings.begin(), timings.end(), [](const BlockTiming& a, const BlockTiming& b) { return a.load < b.load; });
+
+        const auto percentile = [&](double p) { return timings[static_cast<size_t>(p * static_cast<double>(timings.size() - 1))].load; };
+        std::printf("  block load (time / budget): median %.2f%%  p99 %.2f%%  max %.2f%%\n",
+                    percentile(0.5) * 100.0, percentile(0.99) * 100.0, timings.back().load * 100.0);
+
+        std::printf("  worst blocks:\n");
+        for (size_t i = 0; i < std::min<size_t>(5, timings.size()); ++i)
+        {
+            const auto& timing = timings[timings.size() - 1 - i];
+            const auto& block = capture.blocks[timing.block];
+            std::printf("    #%-8d %5d samples  %7.2f%%  bpm %.2f  tier %d  %d param events\n",
+                        block.sequence, block.input.getNumSamples(), timing.load * 100.0,
+                        block.bpm, block.qualityTier, static_cast<int>(block.events.size()));
+        }
+
+        double stageTotal = 0.0;
+        for (auto seconds : result.stageSeconds)
+            stageTotal += seconds;
+
+        if (stageTotal > 0.0)
+        {
+            std::printf("  stages:\n");
+            for (int stage = 0; stage < StageProfiler::numStages; ++stage)
+            {
+                const double seconds = result.stageSeconds[static_cast<size_t>(stage)];
+                std::printf("    %-10s %8.3f ms  %5.1f%%\n", StageProfiler::getStageName(stage),
+                            seconds * 1000.0, seconds / stageTotal * 100.0);
+            }
+        }
+    }
+
+    int usage()
+    {
+        std::fprintf(stderr, "usage: DRIFTReplay <capture.driftcap> [--repeat N] [--isa name] [--output out.wav] [--spectrum]\n");
+        return 1;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(juce::CharPointer_UTF8(argv[i]));
+
+    juce::File captureFile, outputFile;
+    int repeat = 1;
+    bool spectrum = false;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        if (args[i] == "--repeat" && i + 1 < args.size())
+            repeat = juce::jmax(1, args[++i].getIntValue());
+        else if (args[i] == "--isa" && i + 1 < args.size())
+        {
+            if (! selectIsa(args[++i]))
+            {
+                std::fprintf(stderr, "kernel ISA '%s' is not available on this machine\n", args[i].toRawUTF8());
+                return 1;
+            }
+        }
+        else if (args[i] == "--output" && i + 1 < args.size())
+            outputFile = juce::File::getCurrentWorkingDirectory().getChildFile(args[++i]);
+        else if (args[i] == "--spectrum")
+            spectrum = true;
+        else if (args[i].startsWith("--") || captureFile != juce::File())
+            return usage();
+        else
+            captureFile = juce::File::getCurrentWorkingDirectory().getChildFile(args[i]);
+    }
+
+    if (captureFile == juce::File())
+        return usage();
+
+    Capture capture;
+    juce::String error;
+    if (! loadCapture(captureFile, capture, error))
+    {
+        std::fprintf(stderr, "%s\n", error.toRawUTF8());
+        return 1;
+    }
+
+    const double sampleRate = capture.blocks.front().prepareSampleRate;
+    std::printf("%s: %d blocks at %.0f Hz, kernels %s\n", captureFile.getFileName().toRawUTF8(),
+                static_cast<int>(capture.blocks.size()), sampleRate, DriftKernels::get().name);
+    if (capture.droppedBlocks > 0)
+        std::printf("warning: %d blocks were dropped while capturing; replay skips over them\n", capture.droppedBlocks);
+
+    juce::AudioBuffer<float> output;
+    for (int pass = 1; pass <= repeat; ++pass)
+        printPass(pass, capture, runPass(capture, (pass == 1 && outputFile != juce::File()) ? &output : nullptr, spectrum));
+
+    if (outputFile != juce::File())
+    {
+        outputFile.deleteFile();
+        juce::WavAudioFormat wav;
+        std::unique_ptr<juce::AudioFormatWriter> writer(wav.createWriterFor(new juce::FileOutputStream(outputFile),
+                                                                            sampleRate, 2, 32, {}, 0));
+        if (writer == nullptr || ! writer->writeFromAudioSampleBuffer(output, 0, output.getNumSamples()))
+        {
+            std::fprintf(stderr, "cannot write %s\n", outputFile.getFullPathName().toRawUTF8());
+            return 1;
+        }
+    }
+
+    return 0;
+}
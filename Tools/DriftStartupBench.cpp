@@ -0,0 +1,214 @@
+// Times what a host does when it loads a session full of DRIFT instances:
+// construct each one, restore its state, prepare it, and finally close them all.
+//
+//   DRIFTStartupBench [--instances N] [--activation] [--analyzer]
+//
+// The first instance is reported on its own, since it pays the once-per-process
+// costs (project data, kernel selection). --activation gives every instance a
+// reference to the shared ActivationService, as builds with activation enabled
+// do, so the cost of starting and stopping its thread shows up too. Tool builds
+// have no activation SDK or project data, so validation never reaches the network
+// here. Try slow servers with a DRIFT_DEV_MODE plugin build pointed at
+// DRIFTMockActivationServer --delay instead.
+//
+// --analyzer then times processBlock on the first instance with the spectrum
+// analyzer off and on (as with its editor open), alternating in rounds so both
+// see the same machine state, and reports what the analyzer's push adds per block.
+// Unlike the "analysis" stage in DRIFTReplay, this needs no DRIFT_STAGE_PROFILING.
+
+#include "../Source/PluginProcessor.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    struct Timings
+    {
+        double totalMs = 0.0;
+        double maxMs = 0.0;
+        int count = 0;
+
+        void add(double ms)
+        {
+            totalMs += ms;
+            maxMs = juce::jmax(maxMs, ms);
+            ++count;
+        }
+    };
+
+    struct Instance
+    {
+        std::unique_ptr<DriftProcessor> processor;
+        std::unique_ptr<juce::SharedResourcePointer<ActivationService>> activation;
+    };
+
+    double elapsedMs(juce::int64 startTicks)
+    {
+        return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks) * 1000.0;
+    }
+
+    void printTimings(const char* label, const Timings& timings)
+    {
+        if (timings.count > 0)
+            std::printf("  %-12s mean %8.3f ms   max %8.3f ms   total %9.2f ms\n", label,
+                        timings.totalMs / timings.count, timings.maxMs, timings.totalMs);
+    }
+
+    double medianMs(std::vector<double>& samples)
+    {
+        const auto middle = samples.begin() + static_cast<std::ptrdiff_t>(samples.size() / 2);
+        std::nth_element(samples.begin(), middle, samples.end());
+        return *middle;
+    }
+
+    struct AnalyzerCost
+    {
+        double offMs = 0.0; // Median processBlock time, analyzer off
+        double onMs = 0.0;  // ... and on
+    };
+
+    // Medians rather than means, so scheduler hiccups don't swamp a cost this small
+    AnalyzerCost timeAnalyzer(DriftProcessor& processor, int blockSize)
+    {
+        constexpr int kRounds = 10;
+        constexpr int kBlocksPerRound = 500;
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midi;
+        juce::Random random(0x5eed);
+        std::vector<double> off, on;
+        off.reserve(kRounds * kBlocksPerRound);
+        on.reserve(kRounds * kBlocksPerRound);
+
+        for (int round = 0; round < kRounds * 2; ++round)
+        {
+            const bool analyzerOn = round % 2 == 1;
+            processor.getSpectrumAnalyzer().setEnabled(analyzerOn);
+            auto& timings = analyzerOn ? on : off;
+
+            for (int b = 0; b < kBlocksPerRound; ++b)
+            {
+                for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+                    for (int i = 0; i < blockSize; ++i)
+                        buffer.setSample(channel, i, 0.5f * (random.nextFloat() * 2.0f - 1.0f));
+
+                const auto start = juce::Time::getHighResolutionTicks();
+                processor.processBlock(buffer, midi);
+                timings.push_back(elapsedMs(start));
+            }
+        }
+
+        processor.getSpectrumAnalyzer().setEnabled(false);
+        return { medianMs(off), medianMs(on) };
+    }
+
+    int usage()
+    {
+        std::fprintf(stderr, "usage: DRIFTStartupBench [--instances N] [--activation] [--analyzer]\n");
+        return 1;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(juce::CharPointer_UTF8(argv[i]));
+
+    int numInstances = 200;
+    bool withActivation = false;
+    bool withAnalyzer = false;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        if (args[i] == "--instances" && i + 1 < args.size())
+            numInstances = juce::jmax(1, args[++i].getIntValue());
+        else if (args[i] == "--activation")
+            withActivation = true;
+        else if (args[i] == "--analyzer")
+            withAnalyzer = true;
+        else
+            return usage();
+    }
+
+    constexpr double kSampleRate = 48000.0;
+    constexpr int kBlockSize = 512;
+
+    std::vector<Instance> instances;
+    instances.reserve(static_cast<size_t>(numInstances));
+
+    Timings first, construct, restore, prepare;
+    juce::MemoryBlock savedState;
+
+    const auto sessionStart = juce::Time::getHighResolutionTicks();
+
+    for (int i = 0; i < numInstances; ++i)
+    {
+        Instance instance;
+
+        auto start = juce::Time::getHighResolutionTicks();
+        instance.processor = std::make_unique<DriftProcessor>();
+        if (withActivation)
+            instance.activation = std::make_unique<juce::SharedResourcePointer<ActivationService>>();
+        const double constructMs = elapsedMs(start);
+
+        // Every instance restores the state the first one saved, as a session would
+        if (i == 0)
+            instance.processor->getStateInformation(savedState);
+
+        start = juce::Time::getHighResolutionTicks();
+        instance.processor->setStateInformation(savedState.getData(), static_cast<int>(savedState.getSize()));
+        const double restoreMs = elapsedMs(start);
+
+        start = juce::Time::getHighResolutionTicks();
+        instance.processor->setRateAndBufferSizeDetails(kSampleRate, kBlockSize);
+        instance.processor->prepareToPlay(kSampleRate, kBlockSize);
+        const double prepareMs = elapsedMs(start);
+
+        if (i == 0)
+        {
+            first.add(constructMs + restoreMs + prepareMs);
+        }
+        else
+        {
+            construct.add(constructMs);
+            restore.add(restoreMs);
+            prepare.add(prepareMs);
+        }
+
+        instances.push_back(std::move(instance));
+    }
+
+    const double loadMs = elapsedMs(sessionStart);
+
+    AnalyzerCost analyzerCost;
+    if (withAnalyzer)
+        analyzerCost = timeAnalyzer(*instances.front().processor, kBlockSize);
+
+    const auto closeStart = juce::Time::getHighResolutionTicks();
+    instances.clear();
+    const double closeMs = elapsedMs(closeStart);
+
+    std::printf("DRIFTStartupBench: %d instances%s, kernels %s\n", numInstances,
+                withActivation ? " with activation" : "", DriftKernels::get().name);
+    printTimings("first", first);
+    printTimings("construct", construct);
+    printTimings("restore", restore);
+    printTimings("prepare", prepare);
+    std::printf("  session load %.2f ms, close %.2f ms\n", loadMs, closeMs);
+
+    if (withAnalyzer)
+    {
+        const double budgetMs = kBlockSize * 1000.0 / kSampleRate;
+        const double overheadMs = analyzerCost.onMs - analyzerCost.offMs;
+
+        std::printf("  processBlock median %.2f us, %.2f us with the analyzer on\n",
+                    analyzerCost.offMs * 1000.0, analyzerCost.onMs * 1000.0);
+        std::printf("  analyzer adds %.2f us per %d-sample block (%.3f%% of the %.2f ms budget)\n",
+                    overheadMs * 1000.0, kBlockSize, 100.0 * overheadMs / budgetMs, budgetMs);
+    }
+    return 0;
+}
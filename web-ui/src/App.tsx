@@ -1,7 +1,9 @@
 import { useState, useEffect, useRef, useCallback } from 'react';
 import { useSliderParam, useToggleParam, useChoiceParam } from './hooks/useJuceParam';
 import { useVisualizerData } from './hooks/useVisualizerData';
+import { useSpectrumData } from './hooks/useSpectrumData';
 import { ActivationScreen } from './components/ActivationScreen';
+import { SpectrumView } from './components/SpectrumView';
 import './index.css';
 
 const DIVISIONS = ['1/1', '1/2', '1/4', '1/8', '1/16', '1/32', '1/4T', '1/8T', '1/16T', '1/4D', '1/8D', '1/16D'];
@@ -34,6 +36,7 @@ function MainApp() {
   const diffuse = useSliderParam('diffuse', 0);
 
   const visualizerData = useVisualizerData();
+  const spectrum = useSpectrumData();
   const canvasRef = useRef<HTMLCanvasElement>(null);
   const timeRef = useRef(0);
 
@@ -312,8 +315,13 @@ function MainApp() {
       <div className="header">
         <div className="logo">DRIFT</div>
         <div className="subtitle">WANDERING DELAY</div>
+        {visualizerData.qualityTier > 0 && (
+          <div className="quality-tier">ECO {visualizerData.qualityTier}</div>
+        )}
       </div>
 
+      <SpectrumView spectrum={spectrum} />
+
       <div className="controls-panel">
         <TimeControl
           syncEnabled={sync.value}
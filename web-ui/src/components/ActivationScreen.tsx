@@ -16,6 +16,8 @@ interface ActivationInfo {
 interface ActivationState {
   isConfigured: boolean
   isActivated: boolean
+  /** True while the shared background validation is still running */
+  isValidating?: boolean
   info?: ActivationInfo
 }
 
@@ -60,6 +62,12 @@ export function ActivationScreen({ onActivated }: { onActivated: () => void }) {
         setActivationInfo(state.info)
         setScreenState('success')
         setTimeout(onActivated, 1500)
+      } else if (state.isActivated && state.isValidating) {
+        // Cached token is valid, validation finishes in the background
+        onActivated()
+      } else if (state.isValidating) {
+        // Wait for the next activationState once validation finishes
+        setScreenState('checking')
       } else {
         setScreenState('input')
       }
@@ -0,0 +1,62 @@
+import { useEffect, useRef } from 'react';
+import type { DriftSpectrumData } from '../hooks/useSpectrumData';
+
+interface SpectrumViewProps {
+  spectrum: DriftSpectrumData;
+}
+
+const WIDTH = 200;
+const HEIGHT = 64;
+
+/**
+ * Dry vs wet spectrum, so the effect of Age, Grit and Diffuse on the repeats is visible.
+ */
+export function SpectrumView({ spectrum }: SpectrumViewProps) {
+  const canvasRef = useRef<HTMLCanvasElement>(null);
+
+  useEffect(() => {
+    const canvas = canvasRef.current;
+    const ctx = canvas?.getContext('2d');
+    if (!canvas || !ctx) return;
+
+    const dpr = window.devicePixelRatio || 1;
+    if (canvas.width !== WIDTH * dpr) {
+      canvas.width = WIDTH * dpr;
+      canvas.height = HEIGHT * dpr;
+    }
+    ctx.setTransform(dpr, 0, 0, dpr, 0, 0);
+    ctx.clearRect(0, 0, WIDTH, HEIGHT);
+
+    const drawCurve = (bands: number[], stroke: string, fill: string) => {
+      if (bands.length < 2) return;
+
+      ctx.beginPath();
+      ctx.moveTo(0, HEIGHT);
+      bands.forEach((level, band) => {
+        const x = (band / (bands.length - 1)) * WIDTH;
+        const y = HEIGHT - (level / 255) * HEIGHT;
+        ctx.lineTo(x, y);
+      });
+      ctx.lineTo(WIDTH, HEIGHT);
+      ctx.closePath();
+      ctx.fillStyle = fill;
+      ctx.fill();
+      ctx.strokeStyle = stroke;
+      ctx.lineWidth = 1;
+      ctx.stroke();
+    };
+
+    drawCurve(spectrum.dry, 'rgba(230, 170, 120, 0.35)', 'rgba(230, 170, 120, 0.05)');
+    drawCurve(spectrum.wet, 'rgba(255, 190, 130, 0.8)', 'rgba(255, 170, 100, 0.12)');
+  }, [spectrum]);
+
+  return (
+    <div className="spectrum">
+      <canvas ref={canvasRef} style={{ width: WIDTH, height: HEIGHT }} />
+      <div className="spectrum-legend">
+        <span className="spectrum-dry">DRY</span>
+        <span className="spectrum-wet">WET</span>
+      </div>
+    </div>
+  );
+}
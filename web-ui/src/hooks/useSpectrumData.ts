@@ -0,0 +1,73 @@
+import { useState, useEffect } from 'react';
+import { isInJuceWebView, addEventListener } from '../lib/juce-bridge';
+
+export interface DriftSpectrumData {
+  minFrequency: number;
+  maxFrequency: number;
+  floorDb: number;
+  /** Log-spaced band levels, 0-255 over floorDb..0 dBFS, lowest band first */
+  dry: number[];
+  wet: number[];
+}
+
+const NUM_DEMO_BANDS = 64;
+
+const defaultData: DriftSpectrumData = {
+  minFrequency: 20,
+  maxFrequency: 20000,
+  floorDb: -90,
+  dry: [],
+  wet: [],
+};
+
+/**
+ * Dry vs wet spectra from the background analyzer (SpectrumAnalyzer.h).
+ * C++ only sends 'spectrumData' while the editor is showing.
+ */
+export function useSpectrumData(): DriftSpectrumData {
+  const [data, setData] = useState<DriftSpectrumData>(defaultData);
+
+  useEffect(() => {
+    if (!isInJuceWebView()) {
+      // Demo spectra when not in JUCE: pink-ish dry, darker and softer wet
+      let animationFrame: number;
+      let time = 0;
+
+      const animate = () => {
+        time += 0.016;
+
+        const dry: number[] = [];
+        const wet: number[] = [];
+        for (let band = 0; band < NUM_DEMO_BANDS; band++) {
+          const tilt = 200 - band * 1.2;
+          const wobble = Math.sin(time * 1.7 + band * 0.4) * 12;
+          dry.push(Math.max(0, Math.min(255, tilt + wobble)));
+          wet.push(Math.max(0, Math.min(255, tilt - 20 - band * 0.9 + wobble * 0.5)));
+        }
+
+        setData({ ...defaultData, dry, wet });
+        animationFrame = requestAnimationFrame(animate);
+      };
+
+      animate();
+      return () => cancelAnimationFrame(animationFrame);
+    }
+
+    const unsubscribe = addEventListener('spectrumData', (eventData: unknown) => {
+      const d = eventData as Partial<DriftSpectrumData>;
+      if (d && typeof d === 'object' && Array.isArray(d.dry) && Array.isArray(d.wet)) {
+        setData({
+          minFrequency: d.minFrequency ?? defaultData.minFrequency,
+          maxFrequency: d.maxFrequency ?? defaultData.maxFrequency,
+          floorDb: d.floorDb ?? defaultData.floorDb,
+          dry: d.dry,
+          wet: d.wet,
+        });
+      }
+    });
+
+    return unsubscribe;
+  }, []);
+
+  return data;
+}
@@ -8,6 +8,8 @@ export interface DriftVisualizerData {
   tap2Level: number;
   tap3Level: number;
   tap4Level: number;
+  /** Adaptive quality tier: 0 = full, 3 = minimum (under CPU pressure) */
+  qualityTier: number;
 }
 
 const defaultData: DriftVisualizerData = {
@@ -17,6 +19,7 @@ const defaultData: DriftVisualizerData = {
   tap2Level: 0,
   tap3Level: 0,
   tap4Level: 0,
+  qualityTier: 0,
 };
 
 export function useVisualizerData(): DriftVisualizerData {
@@ -43,6 +46,7 @@ export function useVisualizerData(): DriftVisualizerData {
           tap2Level: inputLevel * 0.5,
           tap3Level: inputLevel * 0.3,
           tap4Level: inputLevel * 0.15,
+          qualityTier: 0,
         });
 
         animationFrame = requestAnimationFrame(animate);
@@ -63,6 +67,7 @@ export function useVisualizerData(): DriftVisualizerData {
           tap2Level: d.tap2Level ?? 0,
           tap3Level: d.tap3Level ?? 0,
           tap4Level: d.tap4Level ?? 0,
+          qualityTier: d.qualityTier ?? 0,
         });
       }
     });
@@ -4,8 +4,13 @@
  * This module provides TypeScript wrappers for JUCE 8's native WebView integration.
  * It interfaces with window.__JUCE__ which is injected by the WebBrowserComponent.
  *
- * IMPORTANT: The relay identifier used here must EXACTLY match the identifier
- * used in C++ when creating WebSliderRelay, WebToggleButtonRelay, etc.
+ * Plugin parameters go through one batched channel instead of a relay per
+ * parameter (see ParameterBridge.h on the C++ side):
+ *   - C++ sends 'parameterState' (ranges + values) on request, then a single
+ *     'parameterUpdate' per UI frame with every parameter that changed.
+ *   - Edits made here are queued and sent once per animation frame as an
+ *     ordered 'parameterChanges' list of begin / value / end operations.
+ * Parameter names must EXACTLY match the IDs in ParameterIDs.h.
  */
 
 // ==============================================================================
@@ -39,8 +44,12 @@ declare global {
 // Event type constants (internal to JUCE)
 const BasicControl_valueChangedEventId = 'valueChanged';
 const BasicControl_propertiesChangedId = 'propertiesChanged';
-const SliderControl_sliderDragStartedEventId = 'sliderDragStarted';
-const SliderControl_sliderDragEndedEventId = 'sliderDragEnded';
+
+// Parameter bridge events (ParameterBridge.cpp)
+const ParameterBridge_requestStateEventId = 'requestParameterState';
+const ParameterBridge_stateEventId = 'parameterState';
+const ParameterBridge_updateEventId = 'parameterUpdate';
+const ParameterBridge_changesEventId = 'parameterChanges';
 
 // ==============================================================================
 // Listener List Helper
@@ -84,6 +93,118 @@ export function isInJuceWebView(): boolean {
 // Alias for backwards compatibility
 export const isJuceEnvironment = isInJuceWebView;
 
+// ==============================================================================
+// Parameter Bridge - Batched Parameter Channel
+// ==============================================================================
+
+interface ParameterProperties {
+  value: number;
+  start: number;
+  end: number;
+  skew: number;
+  interval: number;
+  name: string;
+  label: string;
+  numSteps: number;
+  parameterIndex: number;
+  isToggle: boolean;
+}
+
+type ParameterChange =
+  | { id: string; type: 'begin' | 'end' }
+  | { id: string; type: 'value'; value: number };
+
+interface ParameterClient {
+  handleProperties(properties: ParameterProperties): void;
+  handleValue(value: number): void;
+}
+
+/**
+ * Single connection to the C++ ParameterBridge shared by every SliderState and
+ * ToggleState. Outgoing edits are coalesced per animation frame: consecutive
+ * values for one parameter collapse to the latest, while gesture begin/end keep
+ * their order so the host sees correctly bracketed undo steps.
+ */
+class ParameterBridge {
+  private clients = new Map<string, ParameterClient[]>();
+  private pending: ParameterChange[] = [];
+  private flushScheduled = false;
+  private listening = false;
+  private stateRequestScheduled = false;
+
+  connect(name: string, client: ParameterClient): void {
+    const list = this.clients.get(name) ?? [];
+    list.push(client);
+    this.clients.set(name, list);
+
+    if (!isInJuceWebView()) return;
+
+    const backend = window.__JUCE__!.backend;
+    if (!this.listening) {
+      this.listening = true;
+      backend.addEventListener(ParameterBridge_stateEventId, (payload) =>
+        this.handleState(payload as { parameters?: Record<string, ParameterProperties> })
+      );
+      backend.addEventListener(ParameterBridge_updateEventId, (payload) =>
+        this.handleUpdate(payload as { values?: Record<string, number> })
+      );
+    }
+
+    // One request per batch of connects (every state constructed in this task),
+    // including states created later, e.g. when a panel mounts
+    if (this.stateRequestScheduled) return;
+    this.stateRequestScheduled = true;
+
+    queueMicrotask(() => {
+      this.stateRequestScheduled = false;
+      backend.emitEvent(ParameterBridge_requestStateEventId, {});
+    });
+  }
+
+  queue(change: ParameterChange): void {
+    if (!isInJuceWebView()) return;
+
+    const last = this.pending[this.pending.length - 1];
+    if (change.type === 'value' && last?.type === 'value' && last.id === change.id) {
+      this.pending[this.pending.length - 1] = change;
+    } else {
+      this.pending.push(change);
+    }
+
+    if (!this.flushScheduled) {
+      this.flushScheduled = true;
+      requestAnimationFrame(() => this.flush());
+    }
+  }
+
+  private flush(): void {
+    this.flushScheduled = false;
+    if (this.pending.length === 0) return;
+
+    const changes = this.pending;
+    this.pending = [];
+    window.__JUCE__!.backend.emitEvent(ParameterBridge_changesEventId, { changes });
+  }
+
+  private handleState(payload: { parameters?: Record<string, ParameterProperties> }): void {
+    for (const [name, properties] of Object.entries(payload.parameters ?? {})) {
+      for (const client of this.clients.get(name) ?? []) {
+        client.handleProperties(properties);
+      }
+    }
+  }
+
+  private handleUpdate(payload: { values?: Record<string, number> }): void {
+    for (const [name, value] of Object.entries(payload.values ?? {})) {
+      for (const client of this.clients.get(name) ?? []) {
+        client.handleValue(value);
+      }
+    }
+  }
+}
+
+const parameterBridge = new ParameterBridge();
+
 // ==============================================================================
 // SliderState - Continuous Parameter Control
 // ==============================================================================
@@ -100,11 +221,10 @@ interface SliderProperties {
 }
 
 /**
- * SliderState manages bidirectional sync with a WebSliderRelay on the C++ side.
+ * SliderState mirrors one continuous or integer parameter through the parameter bridge.
  */
 export class SliderState {
   readonly name: string;
-  private identifier: string;
   private scaledValue = 0;
   private properties: SliderProperties = {
     start: 0,
@@ -122,74 +242,41 @@ export class SliderState {
 
   constructor(name: string) {
     this.name = name;
-    this.identifier = '__juce__slider' + name;
-
-    if (isInJuceWebView()) {
-      window.__JUCE__!.backend.addEventListener(this.identifier, (event) =>
-        this.handleEvent(event as Record<string, unknown>)
-      );
 
-      // Request initial state from C++
-      window.__JUCE__!.backend.emitEvent(this.identifier, {
-        eventType: 'requestInitialUpdate',
-      });
-    }
+    parameterBridge.connect(name, {
+      handleProperties: (properties) => {
+        const { value, isToggle: _, ...rest } = properties;
+        this.properties = rest;
+        this.scaledValue = value;
+        this.propertiesChangedEvent.callListeners();
+        this.valueChangedEvent.callListeners();
+      },
+      handleValue: (value) => {
+        this.scaledValue = value;
+        this.valueChangedEvent.callListeners();
+      },
+    });
   }
 
   /** Set value from 0-1 normalized range */
   setNormalisedValue(newValue: number): void {
-    this.scaledValue = this.snapToLegalValue(
-      this.normalisedToScaledValue(newValue)
-    );
-
-    if (isInJuceWebView()) {
-      window.__JUCE__!.backend.emitEvent(this.identifier, {
-        eventType: BasicControl_valueChangedEventId,
-        value: this.scaledValue,
-      });
-    }
+    this.setScaledValue(this.normalisedToScaledValue(newValue));
   }
 
   /** Set value in parameter's native range */
   setScaledValue(newValue: number): void {
     this.scaledValue = this.snapToLegalValue(newValue);
-
-    if (isInJuceWebView()) {
-      window.__JUCE__!.backend.emitEvent(this.identifier, {
-        eventType: BasicControl_valueChangedEventId,
-        value: this.scaledValue,
-      });
-    }
+    parameterBridge.queue({ id: this.name, type: 'value', value: this.scaledValue });
   }
 
   /** Call when user starts dragging (for undo grouping) */
   sliderDragStarted(): void {
-    if (isInJuceWebView()) {
-      window.__JUCE__!.backend.emitEvent(this.identifier, {
-        eventType: SliderControl_sliderDragStartedEventId,
-      });
-    }
+    parameterBridge.queue({ id: this.name, type: 'begin' });
   }
 
   /** Call when user stops dragging (for undo grouping) */
   sliderDragEnded(): void {
-    if (isInJuceWebView()) {
-      window.__JUCE__!.backend.emitEvent(this.identifier, {
-        eventType: SliderControl_sliderDragEndedEventId,
-      });
-    }
-  }
-
-  private handleEvent(event: Record<string, unknown>): void {
-    if (event.eventType === BasicControl_valueChangedEventId) {
-      this.scaledValue = event.value as number;
-      this.valueChangedEvent.callListeners();
-    }
-    if (event.eventType === BasicControl_propertiesChangedId) {
-      const { eventType: _, ...rest } = event;
-      this.properties = rest as unknown as SliderProperties;
-      this.propertiesChangedEvent.callListeners();
-    }
+    parameterBridge.queue({ id: this.name, type: 'end' });
   }
 
   /** Get value in parameter's native range */
@@ -240,11 +327,10 @@ export class SliderState {
 // ==============================================================================
 
 /**
- * ToggleState manages bidirectional sync with a WebToggleButtonRelay on the C++ side.
+ * ToggleState mirrors one boolean parameter through the parameter bridge.
  */
 export class ToggleState {
   readonly name: string;
-  private identifier: string;
   private _value = false;
 
   valueChangedEvent = new ListenerList();
@@ -252,17 +338,18 @@ export class ToggleState {
 
   constructor(name: string) {
     this.name = name;
-    this.identifier = '__juce__toggle' + name;
-
-    if (isInJuceWebView()) {
-      window.__JUCE__!.backend.addEventListener(this.identifier, (event) =>
-        this.handleEvent(event as Record<string, unknown>)
-      );
 
-      window.__JUCE__!.backend.emitEvent(this.identifier, {
-        eventType: 'requestInitialUpdate',
-      });
-    }
+    parameterBridge.connect(name, {
+      handleProperties: (properties) => {
+        this._value = properties.value >= 0.5;
+        this.propertiesChangedEvent.callListeners();
+        this.valueChangedEvent.callListeners();
+      },
+      handleValue: (value) => {
+        this._value = value >= 0.5;
+        this.valueChangedEvent.callListeners();
+      },
+    });
   }
 
   getValue(): boolean {
@@ -271,23 +358,7 @@ export class ToggleState {
 
   setValue(newValue: boolean): void {
     this._value = newValue;
-
-    if (isInJuceWebView()) {
-      window.__JUCE__!.backend.emitEvent(this.identifier, {
-        eventType: BasicControl_valueChangedEventId,
-        value: this._value,
-      });
-    }
-  }
-
-  private handleEvent(event: Record<string, unknown>): void {
-    if (event.eventType === BasicControl_valueChangedEventId) {
-      this._value = event.value as boolean;
-      this.valueChangedEvent.callListeners();
-    }
-    if (event.eventType === BasicControl_propertiesChangedId) {
-      this.propertiesChangedEvent.callListeners();
-    }
+    parameterBridge.queue({ id: this.name, type: 'value', value: newValue ? 1 : 0 });
   }
 }
 
@@ -380,7 +451,7 @@ const comboBoxStates = new Map<string, ComboBoxState>();
 
 /**
  * Get or create a SliderState for the given parameter name.
- * The name must match the identifier used in C++ WebSliderRelay("name").
+ * The name must match the parameter ID in ParameterIDs.h.
  */
 export function getSliderState(name: string): SliderState {
   if (!sliderStates.has(name)) {
@@ -391,7 +462,7 @@ export function getSliderState(name: string): SliderState {
 
 /**
  * Get or create a ToggleState for the given parameter name.
- * The name must match the identifier used in C++ WebToggleButtonRelay("name").
+ * The name must match the parameter ID in ParameterIDs.h.
  */
 export function getToggleState(name: string): ToggleState {
   if (!toggleStates.has(name)) {